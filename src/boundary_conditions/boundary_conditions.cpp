@@ -180,6 +180,7 @@ void incflo::init_bcs ()
         {
             amrex::Print() << bcid << " set to mixed inflow outflow.\n";
             m_has_mixedBC = true;
+            m_bc_mask_cache.set_time_dependent(prob_mixedBC_is_time_dependent());
 #ifdef AMREX_USE_EB
             // ReadParameters() already called
             if (m_advection_type != "Godunov") { amrex::Abort("mixed BCs require Godunov"); }
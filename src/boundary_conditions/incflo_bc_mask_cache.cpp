@@ -0,0 +1,69 @@
+#include <incflo_bc_mask_cache.H>
+
+using namespace amrex;
+
+iMultiFab*
+BCMaskCache::find_imf (int lev, std::string const& field, Real time)
+{
+    auto it = m_imfs.find(Key(lev, field));
+    if (it == m_imfs.end() || (m_time_dependent && it->second.time != time)) {
+        return nullptr;
+    }
+    return it->second.data.get();
+}
+
+iMultiFab*
+BCMaskCache::store_imf (int lev, std::string const& field, Real time,
+                        std::unique_ptr<iMultiFab>&& imf)
+{
+    auto& entry = m_imfs[Key(lev, field)];
+    entry.time = time;
+    entry.data = std::move(imf);
+    return entry.data.get();
+}
+
+Vector<MultiFab>*
+BCMaskCache::find_mfs (int lev, std::string const& field, Real time)
+{
+    auto it = m_mfs.find(Key(lev, field));
+    if (it == m_mfs.end() || (m_time_dependent && it->second.time != time)) {
+        return nullptr;
+    }
+    return &(it->second.data);
+}
+
+Vector<MultiFab>&
+BCMaskCache::store_mfs (int lev, std::string const& field, Real time,
+                        Vector<MultiFab>&& mfs)
+{
+    auto& entry = m_mfs[Key(lev, field)];
+    entry.time = time;
+    entry.data = std::move(mfs);
+    return entry.data;
+}
+
+void
+BCMaskCache::clear (int lev)
+{
+    for (auto it = m_imfs.begin(); it != m_imfs.end(); ) {
+        if (it->first.first == lev) {
+            it = m_imfs.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    for (auto it = m_mfs.begin(); it != m_mfs.end(); ) {
+        if (it->first.first == lev) {
+            it = m_mfs.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void
+BCMaskCache::clear ()
+{
+    m_imfs.clear();
+    m_mfs.clear();
+}
@@ -9,6 +9,8 @@ using namespace amrex;
 
 void incflo::fillpatch_velocity (int lev, Real time, MultiFab& vel, int ng)
 {
+    Telemetry::Timer timer(m_telemetry, Telemetry::Phase::FillPatch);
+
     if (lev == 0) {
         PhysBCFunct<GpuBndryFuncFab<IncfloVelFill> > physbc
             (geom[lev], get_velocity_bcrec(),
@@ -45,6 +47,8 @@ void incflo::fillpatch_velocity (int lev, Real time, MultiFab& vel, int ng)
 
 void incflo::fillpatch_density (int lev, Real time, MultiFab& density, int ng)
 {
+    Telemetry::Timer timer(m_telemetry, Telemetry::Phase::FillPatch);
+
     if (lev == 0) {
         PhysBCFunct<GpuBndryFuncFab<IncfloDenFill> > physbc(geom[lev], get_density_bcrec(),
                                                             IncfloDenFill{m_probtype, m_bc_density, m_bc_velocity});
@@ -80,6 +84,8 @@ void incflo::fillpatch_density (int lev, Real time, MultiFab& density, int ng)
 
 void incflo::fillpatch_tracer (int lev, Real time, MultiFab& tracer, int ng)
 {
+    Telemetry::Timer timer(m_telemetry, Telemetry::Phase::FillPatch);
+
     if (m_ntrac <= 0) return;
     if (lev == 0) {
         PhysBCFunct<GpuBndryFuncFab<IncfloTracFill> > physbc
@@ -116,6 +122,8 @@ void incflo::fillpatch_tracer (int lev, Real time, MultiFab& tracer, int ng)
 
 void incflo::fillpatch_gradp (int lev, Real time, MultiFab& gp, int ng)
 {
+    Telemetry::Timer timer(m_telemetry, Telemetry::Phase::FillPatch);
+
     if (lev == 0) {
         PhysBCFunct<GpuBndryFuncFab<IncfloForFill> > physbc
             (geom[lev], get_force_bcrec(), IncfloForFill{m_probtype});
@@ -143,8 +151,43 @@ void incflo::fillpatch_gradp (int lev, Real time, MultiFab& gp, int ng)
     }
 }
 
+// mac_phi only has one time level and uses the (first order extrapolation or
+// periodic) boundary conditions of the forcing terms
+void incflo::fillpatch_mac_phi (int lev, Real time, MultiFab& mac_phi, int ng)
+{
+    Telemetry::Timer timer(m_telemetry, Telemetry::Phase::FillPatch);
+
+    const auto& bcrec = get_force_bcrec();
+    if (lev == 0) {
+        PhysBCFunct<GpuBndryFuncFab<IncfloForFill> > physbc
+            (geom[lev], bcrec, IncfloForFill{m_probtype});
+        FillPatchSingleLevel(mac_phi, IntVect(ng), time,
+                             {&(m_leveldata[lev]->mac_phi)}, {time},
+                             0, 0, 1, geom[lev], physbc, 0);
+    } else {
+        PhysBCFunct<GpuBndryFuncFab<IncfloForFill> > cphysbc
+            (geom[lev-1], bcrec, IncfloForFill{m_probtype});
+        PhysBCFunct<GpuBndryFuncFab<IncfloForFill> > fphysbc
+            (geom[lev], bcrec, IncfloForFill{m_probtype});
+#ifdef AMREX_USE_EB
+        Interpolater* mapper = (EBFactory(0).isAllRegular()) ?
+            (Interpolater*)(&cell_cons_interp) : (Interpolater*)(&eb_cell_cons_interp);
+#else
+        Interpolater* mapper = &cell_cons_interp;
+#endif
+        FillPatchTwoLevels(mac_phi, IntVect(ng), time,
+                           {&(m_leveldata[lev-1]->mac_phi)}, {time},
+                           {&(m_leveldata[lev]->mac_phi)}, {time},
+                           0, 0, 1, geom[lev-1], geom[lev],
+                           cphysbc, 0, fphysbc, 0,
+                           refRatio(lev-1), mapper, bcrec, 0);
+    }
+}
+
 void incflo::fillpatch_force (Real time, Vector<MultiFab*> const& force, int ng)
 {
+    Telemetry::Timer timer(m_telemetry, Telemetry::Phase::FillPatch);
+
     const int ncomp = force[0]->nComp();
     const auto& bcrec = get_force_bcrec();
     int lev = 0;
@@ -253,3 +296,23 @@ void incflo::fillcoarsepatch_gradp (int lev, Real time, MultiFab& gp, int ng)
                                  cphysbc, 0, fphysbc, 0,
                                  refRatio(lev-1), mapper, bcrec, 0);
 }
+
+void incflo::fillcoarsepatch_mac_phi (int lev, Real time, MultiFab& mac_phi, int ng)
+{
+    const auto& bcrec = get_force_bcrec();
+    PhysBCFunct<GpuBndryFuncFab<IncfloForFill> > cphysbc
+        (geom[lev-1], bcrec, IncfloForFill{m_probtype});
+    PhysBCFunct<GpuBndryFuncFab<IncfloForFill> > fphysbc
+        (geom[lev], bcrec, IncfloForFill{m_probtype});
+#ifdef AMREX_USE_EB
+    Interpolater* mapper = (EBFactory(0).isAllRegular()) ?
+        (Interpolater*)(&cell_cons_interp) : (Interpolater*)(&eb_cell_cons_interp);
+#else
+    Interpolater* mapper = &cell_cons_interp;
+#endif
+    amrex::InterpFromCoarseLevel(mac_phi, IntVect(ng), time,
+                                 m_leveldata[lev-1]->mac_phi, 0, 0, 1,
+                                 geom[lev-1], geom[lev],
+                                 cphysbc, 0, fphysbc, 0,
+                                 refRatio(lev-1), mapper, bcrec, 0);
+}
@@ -191,6 +191,80 @@ incflo::make_robinBC_MFs(int lev, MultiFab* state)
     return robin;
 }
 
+iMultiFab*
+incflo::get_BC_MF (int lev, Gpu::DeviceVector<BCRec> const& bcs, std::string const& field)
+{
+    iMultiFab* BC_MF = m_bc_mask_cache.find_imf(lev, field, m_cur_time);
+    if (!BC_MF) {
+        BC_MF = m_bc_mask_cache.store_imf(lev, field, m_cur_time, make_BC_MF(lev, bcs, field));
+    }
+    return BC_MF;
+}
+
+iMultiFab const&
+incflo::get_nodalBC_mask (int lev)
+{
+    iMultiFab* mask = m_bc_mask_cache.find_imf(lev, "projection", m_cur_time);
+    if (!mask) {
+        mask = m_bc_mask_cache.store_imf(lev, "projection", m_cur_time,
+                                         std::make_unique<iMultiFab>(make_nodalBC_mask(lev)));
+    }
+    return *mask;
+}
+
+Vector<MultiFab> const&
+incflo::get_robinBC_MFs (int lev, MultiFab* state)
+{
+    // The MAC projection BCs are homogeneous and can be reused as they are
+    if (!state) {
+        Vector<MultiFab>* robin = m_bc_mask_cache.find_mfs(lev, "mac", m_cur_time);
+        if (!robin) {
+            robin = &m_bc_mask_cache.store_mfs(lev, "mac", m_cur_time, make_robinBC_MFs(lev));
+        }
+        return *robin;
+    }
+
+    Vector<MultiFab>* robin = m_bc_mask_cache.find_mfs(lev, "diffusion", m_cur_time);
+    if (!robin) {
+        return m_bc_mask_cache.store_mfs(lev, "diffusion", m_cur_time, make_robinBC_MFs(lev, state));
+    }
+
+    // For diffusion only f depends on the state: the BC is either Dirichlet
+    // (a=1, b=0, f=state) or Neumann (a=0, b=1, f=0), so f = a*state. The
+    // solvers copy the Robin BC data, so one set per level serves all fields.
+    MultiFab const& robin_a = (*robin)[0];
+    MultiFab& robin_f = (*robin)[2];
+    int const nghost = robin_a.nGrow();
+
+    Box const& domain = Geom(lev).Domain();
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(robin_f); mfi.isValid(); ++mfi) {
+        Box const& gbx = amrex::grow(mfi.validbox(),nghost);
+        Array4<Real const> const& a_arr = robin_a.const_array(mfi);
+        Array4<Real> const& f_arr = robin_f.array(mfi);
+        Array4<Real const> const& bcv = state->const_array(mfi);
+        for (int dir = 0; dir < AMREX_SPACEDIM; ++dir) {
+            Orientation olo(dir,Orientation::low);
+            Orientation ohi(dir,Orientation::high);
+            Box blo = (m_bc_type[olo] == BC::mixed) ? (gbx & adjCellLo(domain,dir)) : Box();
+            Box bhi = (m_bc_type[ohi] == BC::mixed) ? (gbx & adjCellHi(domain,dir)) : Box();
+            for (Box const& b : {blo, bhi}) {
+                if (b.ok()) {
+                    ParallelFor(b, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                    {
+                        f_arr(i,j,k) = a_arr(i,j,k) * bcv(i,j,k);
+                    });
+                }
+            }
+        }
+    }
+
+    return *robin;
+}
+
 #ifdef AMREX_USE_EB
 void
 incflo::set_eb_velocity (int lev, Real /*time*/, MultiFab& eb_vel, int nghost)
@@ -20,6 +20,9 @@ incflo::compute_MAC_projected_velocities (
 
     auto mac_phi = get_mac_phi();
 
+    bool const use_fft = (m_mac_solver == "fft") && fft_projection_available("mac_proj");
+    bool const use_mixed = !use_fft && use_mixed_precision_mac();
+
     // We first compute the velocity forcing terms to be used in predicting
     //    to faces before the MAC projection
     if (m_advection_type != "MOL") {
@@ -93,10 +96,13 @@ incflo::compute_MAC_projected_velocities (
     //
     // Initialize (or redefine the beta in) the MacProjector
     //
-    if (macproj->needInitialization())
+    if (use_fft)
+    {
+        // The FFT solver does not need the MacProjector
+    }
+    else if (macproj->needInitialization())
     {
-        LPInfo lp_info;
-        lp_info.setMaxCoarseningLevel(m_mac_mg_max_coarsening_level);
+        LPInfo const lp_info = mac_lp_info();
 #ifndef AMREX_USE_EB
         if (m_constant_density) {
             Vector<BoxArray> ba;
@@ -116,7 +122,7 @@ incflo::compute_MAC_projected_velocities (
         if ( m_has_mixedBC ) {
             for (int lev = 0; lev <= finest_level; ++lev)
             {
-                auto const robin = make_robinBC_MFs(lev);
+                auto const& robin = get_robinBC_MFs(lev);
                 macproj->setLevelBC(lev, nullptr,
                                     &robin[0], &robin[1], &robin[2]);
             }
@@ -149,17 +155,11 @@ incflo::compute_MAC_projected_velocities (
             l_advection_type = "Godunov";
         }
 
-        std::unique_ptr<iMultiFab> BC_MF;
+        iMultiFab* BC_MF = nullptr;
         if (m_has_mixedBC) {
-            // Create a MF to hold the BCType info. Note that this is different than the
+            // The MF holding the BCType info. Note that this is different than the
             // bcs for the MAC projection because the MAC operates on phi, this is velocity.
-            //
-            // TODO? Could consider creating an incflo member variable to save the BC_MF
-            //     amrex::Vector<std::unique_ptr<amrex::iMultiFab> > m_BC_MF;
-            // Could stack components as vel, density, tracer, and then could use for
-            // scalars' advective step as well. But not sure it really matters one way or
-            // the other.
-            BC_MF = make_BC_MF(lev, m_bcrec_velocity_d, "velocity");
+            BC_MF = get_BC_MF(lev, m_bcrec_velocity_d, "velocity");
         }
 
         // Predict normal velocity to faces -- note that the {u_mac, v_mac, w_mac}
@@ -175,7 +175,7 @@ incflo::compute_MAC_projected_velocities (
 #endif
                                       m_godunov_ppm, m_godunov_use_forces_in_trans,
                                       l_advection_type, PPM::default_limiter,
-                                      allow_inflow_on_outflow, BC_MF.get());
+                                      allow_inflow_on_outflow, BC_MF);
     }
 
     Vector<Array<MultiFab*,AMREX_SPACEDIM> > mac_vec(finest_level+1);
@@ -188,7 +188,7 @@ incflo::compute_MAC_projected_velocities (
 
     const auto *bc_vel_d = get_velocity_bcrec_device_ptr();
 
-    std::unique_ptr<iMultiFab> velBC_MF;
+    iMultiFab const* velBC_MF = nullptr;
 
     //
     // This loop is only necessary if there is time-dependent inflow but we don't have a good test for that
@@ -205,7 +205,7 @@ incflo::compute_MAC_projected_velocities (
         const auto dhi = ubound(domain);
 
         if (m_has_mixedBC) {
-            velBC_MF = make_BC_MF(lev, m_bcrec_velocity_d, "velocity");
+            velBC_MF = get_BC_MF(lev, m_bcrec_velocity_d, "velocity");
         }
 
         for (MFIter mfi(time_dep_inflow_vel,false); mfi.isValid(); ++mfi)
@@ -269,6 +269,27 @@ incflo::compute_MAC_projected_velocities (
         HydroUtils::enforceInOutSolvability(mac_vec, get_velocity_bcrec().data(), geom);
     }
 
+    if (m_verbose > 0) amrex::Print() << "MAC Projection:\n";
+
+    if (use_fft)
+    {
+        // Direct solve with beta = dt/ro_0; mac_phi is only kept if it is used
+        MultiFab& phi_fft = m_scratch.get(0, "fft_mac_phi", grids[0], dmap[0], 1, 1, *m_factory[0]);
+        {
+            Telemetry::Timer timer(m_telemetry, Telemetry::Phase::MacProj);
+            fft_mac_projection(mac_vec[0], l_dt/m_ro_0, phi_fft);
+        }
+        m_telemetry.record_solve("mac_proj_fft", 0, Real(0.0));
+
+        if (m_use_mac_phi_in_godunov || m_mac_warm_start) {
+            MultiFab::Copy(*mac_phi[0], phi_fft, 0, 0, 1, 1);
+            if (m_use_mac_phi_in_godunov) {
+                mac_phi[0]->mult(2.0,0,1,1);
+            }
+        }
+        return;
+    }
+
     macproj->setUMAC(mac_vec);
 
 #ifdef AMREX_USE_EB
@@ -280,23 +301,48 @@ incflo::compute_MAC_projected_velocities (
     }
 #endif
 
-    if (m_verbose > 0) amrex::Print() << "MAC Projection:\n";
     //
     // Perform MAC projection
     //
-    if (m_use_mac_phi_in_godunov)
+    Real const mac_rtol = mac_projection_rtol(mac_vec);
+
+    Telemetry::Timer timer(m_telemetry, Telemetry::Phase::MacProj);
+    if (m_use_mac_phi_in_godunov || m_mac_warm_start || use_mixed)
     {
-        // The MAC projection always starts with phi == 0, but we might like
-        //     to change that so we reduce the cost of the MAC projection
-        for (int lev=0; lev <= finest_level; ++lev)
-            mac_phi[lev]->setVal(0.);
+        // With warm start, mac_phi holds the solution of the previous MAC
+        //     projection (predictor or corrector, before or after a regrid),
+        //     which is a good initial guess for this one. Otherwise we start
+        //     from phi == 0. With m_use_mac_phi_in_godunov the stored mac_phi
+        //     is twice the solution.
+        for (int lev=0; lev <= finest_level; ++lev) {
+            if (!m_mac_warm_start) {
+                mac_phi[lev]->setVal(0.);
+            } else if (m_use_mac_phi_in_godunov) {
+                mac_phi[lev]->mult(0.5,0,1,1);
+            }
+        }
+
+        // Get most of the way there in single precision; the MacProjector
+        //     then only has to check (and, if needed, finish) the solve
+        if (use_mixed) {
+            mixed_precision_mac_solve(mac_vec, l_dt/m_ro_0, mac_rtol, mac_phi);
+        }
 
-        macproj->project(mac_phi,m_mac_mg_rtol,m_mac_mg_atol);
+        macproj->project(mac_phi,mac_rtol,m_mac_mg_atol);
 
-        for (int lev=0; lev <= finest_level; ++lev)
-            mac_phi[lev]->mult(2.0,0,1,1);
+        if (m_use_mac_phi_in_godunov) {
+            for (int lev=0; lev <= finest_level; ++lev)
+                mac_phi[lev]->mult(2.0,0,1,1);
+        }
     } else {
-        macproj->project(m_mac_mg_rtol,m_mac_mg_atol);
+        macproj->project(mac_rtol,m_mac_mg_atol);
+    }
+    m_telemetry.record_solve("mac_proj", macproj->getMLMG().getNumIters(),
+                             macproj->getMLMG().getFinalResidual(),
+                             m_mac_adaptive_tol.enabled ? mac_rtol : Real(-1.0));
+    if (m_mac_adaptive_tol.enabled && m_verbose > 0) {
+        amrex::Print() << "MAC projection: rtol = " << mac_rtol << " (adaptive), "
+                       << macproj->getMLMG().getNumIters() << " iterations" << std::endl;
     }
     // Note that the macproj->project call above ensures that the MAC velocities are averaged down --
     //      we don't need to do that again here
@@ -338,18 +338,18 @@ incflo::compute_convective_term (Vector<MultiFab*> const& conv_u,
         //
         // Create BC MF first (to hold bc's that vary in space along the face)
         //
-        std::unique_ptr<iMultiFab> velBC_MF;
+        iMultiFab const* velBC_MF = nullptr;
         if (m_has_mixedBC) {
-            velBC_MF = make_BC_MF(lev, m_bcrec_velocity_d, "velocity");
+            velBC_MF = get_BC_MF(lev, m_bcrec_velocity_d, "velocity");
         }
-        std::unique_ptr<iMultiFab> densBC_MF;
+        iMultiFab const* densBC_MF = nullptr;
         if (m_has_mixedBC) {
-            densBC_MF = make_BC_MF(lev, m_bcrec_density_d, "density");
+            densBC_MF = get_BC_MF(lev, m_bcrec_density_d, "density");
         }
-        std::unique_ptr<iMultiFab> tracBC_MF;
+        iMultiFab const* tracBC_MF = nullptr;
         if (m_advect_tracer  && (m_ntrac>0)) {
             if (m_has_mixedBC) {
-                tracBC_MF = make_BC_MF(lev, m_bcrec_tracer_d, "tracer");
+                tracBC_MF = get_BC_MF(lev, m_bcrec_tracer_d, "tracer");
             }
         }
 
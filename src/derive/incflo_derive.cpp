@@ -40,61 +40,14 @@ void incflo::ComputeDivU(Real /*time_in*/)
 #endif
 }
 
-#ifdef AMREX_USE_EB
+// The strain rate is computed (or taken from the cache) together with eta
 void incflo::compute_strainrate_at_level (int lev,
-#else
-void incflo::compute_strainrate_at_level (int /*lev*/,
-#endif
                                           MultiFab* strainrate,
                                           MultiFab* vel,
-                                          Geometry& lev_geom,
+                                          Geometry& /*lev_geom*/,
                                           Real /*time*/, int nghost)
 {
-
-#ifdef AMREX_USE_EB
-        auto const& fact = EBFactory(lev);
-        auto const& flags = fact.getMultiEBCellFlagFab();
-#endif
-
-        AMREX_D_TERM(Real idx = Real(1.0) / lev_geom.CellSize(0);,
-                     Real idy = Real(1.0) / lev_geom.CellSize(1);,
-                     Real idz = Real(1.0) / lev_geom.CellSize(2););
-
-#ifdef _OPENMP
-#pragma omp parallel if (Gpu::notInLaunchRegion())
-#endif
-        for (MFIter mfi(*strainrate,TilingIfNotGPU()); mfi.isValid(); ++mfi)
-        {
-                Box const& bx = mfi.growntilebox(nghost);
-                Array4<Real> const& sr_arr = strainrate->array(mfi);
-                Array4<Real const> const& vel_arr = vel->const_array(mfi);
-#ifdef AMREX_USE_EB
-                auto const& flag_fab = flags[mfi];
-                auto typ = flag_fab.getType(bx);
-                if (typ == FabType::covered)
-                {
-                    ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
-                    {
-                        sr_arr(i,j,k) = Real(0.0);
-                    });
-                }
-                else if (typ == FabType::singlevalued)
-                {
-                    auto const& flag_arr = flag_fab.const_array();
-                    ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
-                    {
-                        sr_arr(i,j,k) = incflo_strainrate_eb(i,j,k,AMREX_D_DECL(idx,idy,idz),vel_arr,flag_arr(i,j,k));
-                    });
-                }
-                else
-#endif
-                {
-                    ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
-                    {
-                        sr_arr(i,j,k) = incflo_strainrate(i,j,k,AMREX_D_DECL(idx,idy,idz),vel_arr);
-                    });
-                }
-        }
+    MultiFab::Copy(*strainrate, strainrate_and_eta(lev, *vel, nghost), 0, 0, 1, nghost);
 }
 
 Real incflo::ComputeKineticEnergy ()
@@ -134,7 +87,7 @@ Real incflo::ComputeKineticEnergy ()
 
     KE *= Real(0.5)/total_vol/ro_0;
 
-    ParallelDescriptor::ReduceRealSum(KE);
+    ParallelAllReduce::Sum<Real>(KE, ParallelContext::CommunicatorSub());
 
     return KE;
 
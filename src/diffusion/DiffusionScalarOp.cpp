@@ -14,10 +14,16 @@ DiffusionScalarOp::DiffusionScalarOp (incflo* a_incflo)
 {
     readParameters();
 
+    m_eta_faces.resize(m_incflo->finestLevel()+1);
+
     LPInfo info_solve;
     info_solve.setMaxCoarseningLevel(m_mg_max_coarsening_level);
     LPInfo info_apply;
     info_apply.setMaxCoarseningLevel(0);
+
+    // With Robin BCs the boundary data depend on each component
+    m_batch_velocity = m_batch_velocity && !m_incflo->m_has_mixedBC;
+    int const vel_ncomp = m_batch_velocity ? AMREX_SPACEDIM : 1;
 #ifdef AMREX_USE_EB
     int finest_level = m_incflo->finestLevel();
     if (!m_incflo->EBFactory(0).isAllRegular())
@@ -43,13 +49,18 @@ DiffusionScalarOp::DiffusionScalarOp (incflo* a_incflo)
             m_eb_vel_solve_op = std::make_unique<MLEBABecLap>(m_incflo->Geom(0,finest_level),
                                                     m_incflo->boxArray(0,finest_level),
                                                     m_incflo->DistributionMap(0,finest_level),
-                                                    info_solve, ebfact);
+                                                    info_solve, ebfact, vel_ncomp);
             m_eb_vel_solve_op->setMaxOrder(m_mg_maxorder);
 
-            // We don't call setDomainBC here because we will need to call it separately for each component
+            // Unless all the components are solved for together, we don't call setDomainBC
+            // here because we will need to call it separately for each component
+            if (m_batch_velocity) {
+                m_eb_vel_solve_op->setDomainBC(get_diffuse_velocity_bcs(Orientation::low),
+                                               get_diffuse_velocity_bcs(Orientation::high));
+            }
         }
 
-        if (m_incflo->need_divtau())
+        if (m_incflo->need_diffusion_apply_ops())
         {
             m_eb_scal_apply_op = std::make_unique<MLEBABecLap>(m_incflo->Geom(0,finest_level),
                                                      m_incflo->boxArray(0,finest_level),
@@ -63,7 +74,7 @@ DiffusionScalarOp::DiffusionScalarOp (incflo* a_incflo)
                                                                             m_incflo->m_bcrec_tracer[0].hi()));
         }
 
-        if ( (m_incflo->need_divtau() && !m_incflo->useTensorSolve()) ||
+        if ( (m_incflo->need_diffusion_apply_ops() && !m_incflo->useTensorSolve()) ||
               m_incflo->useTensorCorrection() )
         {
             m_eb_vel_apply_op = std::make_unique<MLEBABecLap>(m_incflo->Geom(0,finest_level),
@@ -93,12 +104,18 @@ DiffusionScalarOp::DiffusionScalarOp (incflo* a_incflo)
             m_reg_vel_solve_op = std::make_unique<MLABecLaplacian>(m_incflo->Geom(0,m_incflo->finestLevel()),
                                                          m_incflo->boxArray(0,m_incflo->finestLevel()),
                                                          m_incflo->DistributionMap(0,m_incflo->finestLevel()),
-                                                         info_solve);
+                                                         info_solve, Vector<FabFactory<FArrayBox> const*>{},
+                                                         vel_ncomp);
             m_reg_vel_solve_op->setMaxOrder(m_mg_maxorder);
 
-            // We don't call setDomainBC here because we will need to call it separately for each component
+            // Unless all the components are solved for together, we don't call setDomainBC
+            // here because we will need to call it separately for each component
+            if (m_batch_velocity) {
+                m_reg_vel_solve_op->setDomainBC(get_diffuse_velocity_bcs(Orientation::low),
+                                                get_diffuse_velocity_bcs(Orientation::high));
+            }
         }
-        if (m_incflo->need_divtau()) {
+        if (m_incflo->need_diffusion_apply_ops()) {
             m_reg_scal_apply_op = std::make_unique<MLABecLaplacian>(m_incflo->Geom(0,m_incflo->finestLevel()),
                                                           m_incflo->boxArray(0,m_incflo->finestLevel()),
                                                           m_incflo->DistributionMap(0,m_incflo->finestLevel()),
@@ -110,7 +127,7 @@ DiffusionScalarOp::DiffusionScalarOp (incflo* a_incflo)
                                                                              m_incflo->m_bcrec_tracer[0].hi()));
         }
 
-        if ( (m_incflo->need_divtau() && !m_incflo->useTensorSolve()) ||
+        if ( (m_incflo->need_diffusion_apply_ops() && !m_incflo->useTensorSolve()) ||
               m_incflo->useTensorCorrection() )
         {
             m_reg_vel_apply_op = std::make_unique<MLABecLaplacian>(m_incflo->Geom(0,m_incflo->finestLevel()),
@@ -144,14 +161,91 @@ DiffusionScalarOp::readParameters ()
 
     pp.query("num_pre_smooth", m_num_pre_smooth);
     pp.query("num_post_smooth", m_num_post_smooth);
+
+    pp.query("batch_tracers", m_batch_tracers);
+    pp.query("batch_velocity", m_batch_velocity);
+}
+
+Vector<Array<LinOpBCType,AMREX_SPACEDIM> >
+DiffusionScalarOp::get_diffuse_velocity_bcs (Orientation::Side side) const
+{
+    Vector<Array<LinOpBCType,AMREX_SPACEDIM> > r;
+    for (int comp = 0; comp < AMREX_SPACEDIM; ++comp) {
+        r.push_back(m_incflo->get_diffuse_velocity_bc(side, comp));
+    }
+    return r;
+}
+
+void
+DiffusionScalarOp::setup_mlmg (MLMG& mlmg) const
+{
+    // The default bottom solver is BiCG
+    if (m_mg_bottom_solver == "smoother")
+    {
+        mlmg.setBottomSolver(MLMG::BottomSolver::smoother);
+    }
+    else if (m_mg_bottom_solver == "hypre")
+    {
+        mlmg.setBottomSolver(MLMG::BottomSolver::hypre);
+    }
+    // Maximum iterations for MultiGrid / ConjugateGradients
+    mlmg.setMaxIter(m_mg_max_iter);
+    mlmg.setMaxFmgIter(m_mg_max_fmg_iter);
+    mlmg.setBottomMaxIter(m_mg_bottom_maxiter);
+
+    // Verbosity for MultiGrid / ConjugateGradients
+    mlmg.setVerbose(m_mg_verbose);
+    mlmg.setBottomVerbose(m_mg_bottom_verbose);
+
+    mlmg.setPreSmooth(m_num_pre_smooth);
+    mlmg.setPostSmooth(m_num_post_smooth);
+}
+
+MLMG&
+DiffusionScalarOp::get_solve_mlmg (std::unique_ptr<MLMG>& mlmg, MLLinOp& op) const
+{
+    // The hypre bottom solver keeps the matrix of the coarsest level until the
+    // operator reports that it needs an update, which neither setScalars nor
+    // setDomainBC does, so with hypre a new MLMG is made for every solve (with
+    // the new dt and the BCs of the component)
+    if (!mlmg || m_mg_bottom_solver == "hypre") {
+        mlmg = std::make_unique<MLMG>(op);
+        setup_mlmg(*mlmg);
+    }
+    return *mlmg;
+}
+
+int
+DiffusionScalarOp::density_version () const
+{
+    return m_incflo->m_has_mixedBC ? -1 : m_incflo->density_version();
+}
+
+int
+DiffusionScalarOp::tra_eta_version () const
+{
+    return m_incflo->m_has_mixedBC ? -1 : incflo::tra_eta_version();
+}
+
+int
+DiffusionScalarOp::vel_eta_version () const
+{
+#ifdef AMREX_USE_EB
+    // The EB Dirichlet values of the velocity are set together with eta
+    if (m_incflo->hasEBFlow()) { return -1; }
+#endif
+    return m_incflo->m_has_mixedBC ? -1 : m_incflo->vel_eta_version();
 }
 
 void
 DiffusionScalarOp::diffuse_scalar (Vector<MultiFab*> const& tracer,
                                    Vector<MultiFab*> const& density,
                                    Vector<MultiFab const*> const& eta,
-                                   Real dt)
+                                   Real dt,
+                                   Vector<MultiFab const*> const& guess)
 {
+    Telemetry::Timer timer(m_incflo->m_telemetry, Telemetry::Phase::Diffusion);
+
     //
     // Solves
     //      alpha a - beta div ( b grad )
@@ -172,6 +266,13 @@ DiffusionScalarOp::diffuse_scalar (Vector<MultiFab*> const& tracer,
     //      b: mu
     //      RHS: tracer
 
+    // With Robin BCs the boundary data depend on each component, so these
+    // are always solved for one at a time
+    if (m_batch_tracers && tracer[0]->nComp() > 1 && !m_incflo->m_has_mixedBC) {
+        diffuse_scalar_batched(tracer, density, eta, dt, guess);
+        return;
+    }
+
     if (m_verbose > 0) {
         amrex::Print() << "Diffusing scalars one at a time ..." << std::endl;
     }
@@ -185,45 +286,21 @@ DiffusionScalarOp::diffuse_scalar (Vector<MultiFab*> const& tracer,
     }
 
     auto iconserv = m_incflo->get_tracer_iconserv();
-#ifdef AMREX_USE_EB
-    if (m_eb_scal_solve_op)
-    {
-        m_eb_scal_solve_op->setScalars(1.0, dt);
-        for (int lev = 0; lev <= finest_level; ++lev) {
-            if ( iconserv[0] ) {
-                m_eb_scal_solve_op->setACoeffs(lev, *density[lev]);
-            } else {
-                m_eb_scal_solve_op->setACoeffs(lev, 1.0);
-            }
-        }
-    }
-    else
-#endif
-    {
-        m_reg_scal_solve_op->setScalars(1.0, dt);
-        for (int lev = 0; lev <= finest_level; ++lev) {
-            if ( iconserv[0] ) {
-                m_reg_scal_solve_op->setACoeffs(lev, *density[lev]);
-            } else {
-                m_reg_scal_solve_op->setACoeffs(lev, 1.0);
-            }
-        }
-    }
 
     for (int comp = 0; comp < tracer[0]->nComp(); ++comp)
     {
+        // The coefficients are only set if they changed since the last solve
+        bool const update_a = m_scal_solve_coeffs.update_a(density_version(), iconserv[comp]);
+        bool const update_b = m_scal_solve_coeffs.update_b(tra_eta_version(), comp);
+
 #ifdef AMREX_USE_EB
         if (m_eb_scal_solve_op)
         {
-            if ( m_incflo->m_has_mixedBC && comp>0 ) {
-                // Must reset scalars (and Acoef, done below) to reuse solver with Robin BC
-                m_eb_scal_solve_op->setScalars(1.0, dt);
-            }
+            // With Robin BC the scalars (and Acoef) must be reset to reuse the solver
+            m_eb_scal_solve_op->setScalars(1.0, dt);
 
             for (int lev = 0; lev <= finest_level; ++lev) {
-                // Only reset Acoeff if necessary.
-                if (comp > 0 &&
-                    ( m_incflo->m_has_mixedBC || (iconserv[comp] != iconserv[comp-1]) ) ) {
+                if (update_a) {
                     if ( iconserv[comp] ) {
                         m_eb_scal_solve_op->setACoeffs(lev, *density[lev]);
                     } else {
@@ -231,15 +308,19 @@ DiffusionScalarOp::diffuse_scalar (Vector<MultiFab*> const& tracer,
                     }
                 }
 
-                Array<MultiFab,AMREX_SPACEDIM> b = m_incflo->average_scalar_eta_to_faces(lev, comp, *eta[lev]);
-                m_eb_scal_solve_op->setBCoeffs(lev, GetArrOfConstPtrs(b), MLMG::Location::FaceCentroid);
+                if (update_b) {
+                    m_incflo->average_scalar_eta_to_faces(lev, comp, *eta[lev], m_eta_faces[lev]);
+                    m_eb_scal_solve_op->setBCoeffs(lev, GetArrOfConstPtrs(m_eta_faces[lev]), MLMG::Location::FaceCentroid);
+                }
             }
         }
         else
 #endif
         {
+            m_reg_scal_solve_op->setScalars(1.0, dt);
+
             for (int lev = 0; lev <= finest_level; ++lev) {
-                if ( comp > 0 && (iconserv[comp] != iconserv[comp-1]) ) {
+                if (update_a) {
                     if ( iconserv[comp] ) {
                         m_reg_scal_solve_op->setACoeffs(lev, *density[lev]);
                     } else {
@@ -247,8 +328,10 @@ DiffusionScalarOp::diffuse_scalar (Vector<MultiFab*> const& tracer,
                     }
                 }
 
-                Array<MultiFab,AMREX_SPACEDIM> b = m_incflo->average_scalar_eta_to_faces(lev, comp, *eta[lev]);
-                m_reg_scal_solve_op->setBCoeffs(lev, GetArrOfConstPtrs(b));
+                if (update_b) {
+                    m_incflo->average_scalar_eta_to_faces(lev, comp, *eta[lev], m_eta_faces[lev]);
+                    m_reg_scal_solve_op->setBCoeffs(lev, GetArrOfConstPtrs(m_eta_faces[lev]));
+                }
             }
         }
 
@@ -257,8 +340,12 @@ DiffusionScalarOp::diffuse_scalar (Vector<MultiFab*> const& tracer,
         for (int lev = 0; lev <= finest_level; ++lev) {
             phi.emplace_back(*tracer[lev], amrex::make_alias, comp, 1);
 
-            if ( !iconserv[comp] ) {
+            // The initial guess overwrites the tracer, so then it needs a copy
+            if ( !iconserv[comp] && guess.empty() ) {
                 rhs.emplace_back(*tracer[lev], amrex::make_alias, comp, 1);
+            } else if ( !iconserv[comp] ) {
+                rhs.emplace_back(rhs_c[lev], amrex::make_alias, 0, 1);
+                MultiFab::Copy(rhs[lev], *tracer[lev], comp, 0, 1, 0);
             } else {
                 rhs.emplace_back(rhs_c[lev], amrex::make_alias, 0, 1);
 #ifdef _OPENMP
@@ -279,7 +366,7 @@ DiffusionScalarOp::diffuse_scalar (Vector<MultiFab*> const& tracer,
 #ifdef AMREX_USE_EB
             if (m_eb_scal_solve_op) {
                 if ( m_incflo->m_has_mixedBC ) {
-                    auto const robin = m_incflo->make_robinBC_MFs(lev, &phi[lev]);
+                    auto const& robin = m_incflo->get_robinBC_MFs(lev, &phi[lev]);
 
                     m_eb_scal_solve_op->setLevelBC(lev, &phi[lev],
                                                    &robin[0], &robin[1], &robin[2]);
@@ -297,34 +384,211 @@ DiffusionScalarOp::diffuse_scalar (Vector<MultiFab*> const& tracer,
             }
         }
 
+        if (!guess.empty()) {
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                MultiFab::Copy(phi[lev], *guess[lev], comp, 0, 1, 0);
+            }
+        }
+
 #ifdef AMREX_USE_EB
-        MLMG mlmg(m_eb_scal_solve_op ? static_cast<MLLinOp&>(*m_eb_scal_solve_op) : static_cast<MLLinOp&>(*m_reg_scal_solve_op));
+        MLMG& mlmg = get_solve_mlmg(m_scal_solve_mlmg,
+                                    m_eb_scal_solve_op ? static_cast<MLLinOp&>(*m_eb_scal_solve_op)
+                                                       : static_cast<MLLinOp&>(*m_reg_scal_solve_op));
 #else
-        MLMG mlmg(*m_reg_scal_solve_op);
+        MLMG& mlmg = get_solve_mlmg(m_scal_solve_mlmg, *m_reg_scal_solve_op);
+#endif
+
+        mlmg.solve(GetVecOfPtrs(phi), GetVecOfConstPtrs(rhs), m_mg_rtol, m_mg_atol);
+        m_incflo->m_telemetry.record_solve("diffuse_scalar", mlmg.getNumIters(), mlmg.getFinalResidual());
+        m_incflo->m_telemetry.set_solve_guess(guess.empty() ? 0 : m_incflo->diffusion_guess_points(),
+                                              mlmg.getInitResidual());
+    }
+}
+
+void
+DiffusionScalarOp::define_batch_op (int ncomp)
+{
+    const int finest_level = m_incflo->finestLevel();
+
+    LPInfo info_solve;
+    info_solve.setMaxCoarseningLevel(m_mg_max_coarsening_level);
+
+    // All the tracers have the same BCs
+    Vector<Array<LinOpBCType,AMREX_SPACEDIM> > bclo(ncomp,
+        m_incflo->get_diffuse_scalar_bc(Orientation::low , m_incflo->m_bcrec_tracer[0].lo()));
+    Vector<Array<LinOpBCType,AMREX_SPACEDIM> > bchi(ncomp,
+        m_incflo->get_diffuse_scalar_bc(Orientation::high, m_incflo->m_bcrec_tracer[0].hi()));
+
+#ifdef AMREX_USE_EB
+    if (m_eb_scal_solve_op)
+    {
+        auto& op = m_eb_scal_batch_ops[ncomp];
+        if (!op) {
+            Vector<EBFArrayBoxFactory const*> ebfact;
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                ebfact.push_back(&(m_incflo->EBFactory(lev)));
+            }
+            op = std::make_unique<MLEBABecLap>(m_incflo->Geom(0,finest_level),
+                                               m_incflo->boxArray(0,finest_level),
+                                               m_incflo->DistributionMap(0,finest_level),
+                                               info_solve, ebfact, ncomp);
+            op->setMaxOrder(m_mg_maxorder);
+            op->setDomainBC(bclo, bchi);
+        }
+    }
+    else
+#endif
+    {
+        auto& op = m_reg_scal_batch_ops[ncomp];
+        if (!op) {
+            op = std::make_unique<MLABecLaplacian>(m_incflo->Geom(0,finest_level),
+                                                   m_incflo->boxArray(0,finest_level),
+                                                   m_incflo->DistributionMap(0,finest_level),
+                                                   info_solve, Vector<FabFactory<FArrayBox> const*>{},
+                                                   ncomp);
+            op->setMaxOrder(m_mg_maxorder);
+            op->setDomainBC(bclo, bchi);
+        }
+    }
+}
+
+//
+// Same system as diffuse_scalar, but each run of consecutive tracers with
+// the same conservation type is solved for in one multi-component solve: the
+// coefficients are set once and the components share the communication of
+// the V-cycles. The convergence test is on the largest residual over the
+// components of the run.
+//
+void
+DiffusionScalarOp::diffuse_scalar_batched (Vector<MultiFab*> const& tracer,
+                                           Vector<MultiFab*> const& density,
+                                           Vector<MultiFab const*> const& eta,
+                                           Real dt,
+                                           Vector<MultiFab const*> const& guess)
+{
+    BL_PROFILE("DiffusionScalarOp::diffuse_scalar_batched");
+
+    const int finest_level = m_incflo->finestLevel();
+    const int ntrac = tracer[0]->nComp();
+
+    auto iconserv = m_incflo->get_tracer_iconserv();
+
+    Vector<MultiFab> rhs_c(finest_level+1);
+    // Note only conservative uses this rhs_c container
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        rhs_c[lev].define(tracer[lev]->boxArray(), tracer[lev]->DistributionMap(), ntrac, 0);
+    }
+
+    for (int comp = 0; comp < ntrac; )
+    {
+        int ncomp = 1;
+        while (comp + ncomp < ntrac && iconserv[comp+ncomp] == iconserv[comp]) {
+            ++ncomp;
+        }
+
+        if (m_verbose > 0) {
+            amrex::Print() << "Diffusing scalars " << comp << " to " << comp+ncomp-1
+                           << " together ..." << std::endl;
+        }
+
+        define_batch_op(ncomp);
+
+        Vector<MultiFab> phi;
+        Vector<MultiFab> rhs;
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            phi.emplace_back(*tracer[lev], amrex::make_alias, comp, ncomp);
+
+            // The initial guess overwrites the tracers, so then they need a copy
+            if ( !iconserv[comp] && guess.empty() ) {
+                rhs.emplace_back(*tracer[lev], amrex::make_alias, comp, ncomp);
+            } else if ( !iconserv[comp] ) {
+                rhs.emplace_back(rhs_c[lev], amrex::make_alias, 0, ncomp);
+                MultiFab::Copy(rhs[lev], *tracer[lev], comp, 0, ncomp, 0);
+            } else {
+                rhs.emplace_back(rhs_c[lev], amrex::make_alias, 0, ncomp);
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
 #endif
+                for (MFIter mfi(rhs[lev],TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+                    Box const& bx = mfi.tilebox();
+                    Array4<Real> const& rhs_a = rhs[lev].array(mfi);
+                    Array4<Real const> const& tra_a = tracer[lev]->const_array(mfi,comp);
+                    Array4<Real const> const& rho_a = density[lev]->const_array(mfi);
+                    ParallelFor(bx, ncomp, [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
+                    {
+                        rhs_a(i,j,k,n) = rho_a(i,j,k) * tra_a(i,j,k,n);
+                    });
+                }
+            }
+        }
+
+        auto& coeffs = m_scal_batch_coeffs[ncomp];
+        bool const update_a = coeffs.update_a(density_version(), iconserv[comp]);
+        bool const update_b = coeffs.update_b(tra_eta_version(), comp);
 
-        // The default bottom solver is BiCG
-        if (m_mg_bottom_solver == "smoother")
+#ifdef AMREX_USE_EB
+        if (m_eb_scal_solve_op)
         {
-            mlmg.setBottomSolver(MLMG::BottomSolver::smoother);
+            auto& op = *m_eb_scal_batch_ops[ncomp];
+            op.setScalars(1.0, dt);
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                if (update_a) {
+                    if ( iconserv[comp] ) {
+                        op.setACoeffs(lev, *density[lev]);
+                    } else {
+                        op.setACoeffs(lev, 1.0);
+                    }
+                }
+
+                if (update_b) {
+                    m_incflo->average_scalar_eta_to_faces(lev, comp, *eta[lev], m_eta_faces[lev], ncomp);
+                    op.setBCoeffs(lev, GetArrOfConstPtrs(m_eta_faces[lev]), MLMG::Location::FaceCentroid);
+                }
+                op.setLevelBC(lev, &phi[lev]);
+            }
         }
-        else if (m_mg_bottom_solver == "hypre")
+        else
+#endif
         {
-            mlmg.setBottomSolver(MLMG::BottomSolver::hypre);
+            auto& op = *m_reg_scal_batch_ops[ncomp];
+            op.setScalars(1.0, dt);
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                if (update_a) {
+                    if ( iconserv[comp] ) {
+                        op.setACoeffs(lev, *density[lev]);
+                    } else {
+                        op.setACoeffs(lev, 1.0);
+                    }
+                }
+
+                if (update_b) {
+                    m_incflo->average_scalar_eta_to_faces(lev, comp, *eta[lev], m_eta_faces[lev], ncomp);
+                    op.setBCoeffs(lev, GetArrOfConstPtrs(m_eta_faces[lev]));
+                }
+                op.setLevelBC(lev, &phi[lev]);
+            }
         }
-        // Maximum iterations for MultiGrid / ConjugateGradients
-        mlmg.setMaxIter(m_mg_max_iter);
-        mlmg.setMaxFmgIter(m_mg_max_fmg_iter);
-        mlmg.setBottomMaxIter(m_mg_bottom_maxiter);
 
-        // Verbosity for MultiGrid / ConjugateGradients
-        mlmg.setVerbose(m_mg_verbose);
-        mlmg.setBottomVerbose(m_mg_bottom_verbose);
+        if (!guess.empty()) {
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                MultiFab::Copy(phi[lev], *guess[lev], comp, 0, ncomp, 0);
+            }
+        }
 
-        mlmg.setPreSmooth(m_num_pre_smooth);
-        mlmg.setPostSmooth(m_num_post_smooth);
+#ifdef AMREX_USE_EB
+        MLMG& mlmg = get_solve_mlmg(m_scal_batch_mlmg[ncomp],
+                                    m_eb_scal_solve_op ? static_cast<MLLinOp&>(*m_eb_scal_batch_ops[ncomp])
+                                                       : static_cast<MLLinOp&>(*m_reg_scal_batch_ops[ncomp]));
+#else
+        MLMG& mlmg = get_solve_mlmg(m_scal_batch_mlmg[ncomp], *m_reg_scal_batch_ops[ncomp]);
+#endif
 
         mlmg.solve(GetVecOfPtrs(phi), GetVecOfConstPtrs(rhs), m_mg_rtol, m_mg_atol);
+        m_incflo->m_telemetry.record_solve("diffuse_scalar", mlmg.getNumIters(), mlmg.getFinalResidual());
+        m_incflo->m_telemetry.set_solve_guess(guess.empty() ? 0 : m_incflo->diffusion_guess_points(),
+                                              mlmg.getInitResidual());
+
+        comp += ncomp;
     }
 }
 
@@ -332,8 +596,11 @@ void
 DiffusionScalarOp::diffuse_vel_components (Vector<MultiFab*> const& vel,
                                            Vector<MultiFab*> const& density,
                                            Vector<MultiFab const*> const& eta,
-                                           Real dt)
+                                           Real dt,
+                                           Vector<MultiFab const*> const& guess)
 {
+    Telemetry::Timer timer(m_incflo->m_telemetry, Telemetry::Phase::Diffusion);
+
     //
     //      alpha a - beta div ( b grad )   <--->   rho - dt div ( mu grad )
     //
@@ -344,14 +611,107 @@ DiffusionScalarOp::diffuse_vel_components (Vector<MultiFab*> const& vel,
     //      a: rho
     //      b: mu
 
-    if (m_verbose > 0) {
-        amrex::Print() << "Diffusing velocity components one at a time ..." << std::endl;
-    }
-
     AMREX_ASSERT(vel[0]->nComp() == AMREX_SPACEDIM);
 
     const int finest_level = m_incflo->finestLevel();
 
+    if (m_batch_velocity)
+    {
+        // All the components in one solve, each with its own domain BCs (set
+        //     in the constructor); they share rho and eta
+        if (m_verbose > 0) {
+            amrex::Print() << "Diffusing velocity components together ..." << std::endl;
+        }
+
+        Vector<MultiFab> phi;
+        Vector<MultiFab> rhs(finest_level+1);
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            vel[lev]->FillBoundary(m_incflo->Geom(lev).periodicity());
+            phi.emplace_back(*vel[lev], amrex::make_alias, 0, AMREX_SPACEDIM);
+
+            rhs[lev].define(vel[lev]->boxArray(), vel[lev]->DistributionMap(), AMREX_SPACEDIM, 0);
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+            for (MFIter mfi(rhs[lev],TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+                Box const& bx = mfi.tilebox();
+                Array4<Real> const& rhs_a = rhs[lev].array(mfi);
+                Array4<Real const> const& vel_a = vel[lev]->const_array(mfi);
+                Array4<Real const> const& rho_a = density[lev]->const_array(mfi);
+                ParallelFor(bx, AMREX_SPACEDIM, [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
+                {
+                    rhs_a(i,j,k,n) = rho_a(i,j,k) * vel_a(i,j,k,n);
+                });
+            }
+        }
+
+        bool const update_a = m_vel_solve_coeffs.update_a(density_version());
+        bool const update_b = m_vel_solve_coeffs.update_b(vel_eta_version());
+
+#ifdef AMREX_USE_EB
+        if (m_eb_vel_solve_op)
+        {
+            m_eb_vel_solve_op->setScalars(1.0, dt);
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                if (update_a) {
+                    m_eb_vel_solve_op->setACoeffs(lev, *density[lev]);
+                }
+
+                if (update_b) {
+                    if (m_incflo->hasEBFlow()) {
+                        m_eb_vel_solve_op->setEBDirichlet(lev, *m_incflo->get_velocity_eb()[lev], *eta[lev]);
+                    } else {
+                        m_eb_vel_solve_op->setEBHomogDirichlet(lev, *eta[lev]);
+                    }
+
+                    m_incflo->average_scalar_eta_to_faces(lev, 0, *eta[lev], m_eta_faces[lev]);
+                    m_eb_vel_solve_op->setBCoeffs(lev, GetArrOfConstPtrs(m_eta_faces[lev]), MLMG::Location::FaceCentroid);
+                }
+                m_eb_vel_solve_op->setLevelBC(lev, &phi[lev]);
+            }
+        }
+        else
+#endif
+        {
+            m_reg_vel_solve_op->setScalars(1.0, dt);
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                if (update_a) {
+                    m_reg_vel_solve_op->setACoeffs(lev, *density[lev]);
+                }
+
+                if (update_b) {
+                    m_incflo->average_scalar_eta_to_faces(lev, 0, *eta[lev], m_eta_faces[lev]);
+                    m_reg_vel_solve_op->setBCoeffs(lev, GetArrOfConstPtrs(m_eta_faces[lev]));
+                }
+                m_reg_vel_solve_op->setLevelBC(lev, &phi[lev]);
+            }
+        }
+
+        if (!guess.empty()) {
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                MultiFab::Copy(phi[lev], *guess[lev], 0, 0, AMREX_SPACEDIM, 0);
+            }
+        }
+
+#ifdef AMREX_USE_EB
+        MLMG& mlmg = get_solve_mlmg(m_vel_solve_mlmg,
+                                    m_eb_vel_solve_op ? static_cast<MLLinOp&>(*m_eb_vel_solve_op)
+                                                      : static_cast<MLLinOp&>(*m_reg_vel_solve_op));
+#else
+        MLMG& mlmg = get_solve_mlmg(m_vel_solve_mlmg, *m_reg_vel_solve_op);
+#endif
+
+        mlmg.solve(GetVecOfPtrs(phi), GetVecOfConstPtrs(rhs), m_mg_rtol, m_mg_atol);
+        m_incflo->m_telemetry.record_solve("diffuse_vel_components", mlmg.getNumIters(), mlmg.getFinalResidual());
+        m_incflo->m_telemetry.set_solve_guess(guess.empty() ? 0 : m_incflo->diffusion_guess_points(),
+                                              mlmg.getInitResidual());
+        return;
+    }
+
+    if (m_verbose > 0) {
+        amrex::Print() << "Diffusing velocity components one at a time ..." << std::endl;
+    }
+
     Vector<MultiFab> rhs(finest_level+1);
     for (int lev = 0; lev <= finest_level; ++lev) {
         rhs[lev].define(vel[lev]->boxArray(), vel[lev]->DistributionMap(), 1, 0);
@@ -361,6 +721,11 @@ DiffusionScalarOp::diffuse_vel_components (Vector<MultiFab*> const& vel,
     {
         int eta_comp = 0;
 
+        // All the components share rho and eta, so unless they change the
+        // coefficients are only set for the first solve
+        bool const update_a = m_vel_solve_coeffs.update_a(density_version());
+        bool const update_b = m_vel_solve_coeffs.update_b(vel_eta_version(), eta_comp);
+
 #ifdef AMREX_USE_EB
         if (m_eb_vel_solve_op)
         {
@@ -371,21 +736,26 @@ DiffusionScalarOp::diffuse_vel_components (Vector<MultiFab*> const& vel,
 
             m_eb_vel_solve_op->setScalars(1.0, dt);
             for (int lev = 0; lev <= finest_level; ++lev) {
-                m_eb_vel_solve_op->setACoeffs(lev, *density[lev]);
+                if (update_a) {
+                    m_eb_vel_solve_op->setACoeffs(lev, *density[lev]);
+                }
 
-                if (m_incflo->hasEBFlow()) {
-                  MultiFab phi(*m_incflo->get_velocity_eb()[lev], amrex::make_alias, comp, 1);
-                  m_eb_vel_solve_op->setEBDirichlet(lev, phi, *eta[lev]);
-                } else {
-                  m_eb_vel_solve_op->setEBHomogDirichlet(lev, *eta[lev]);
+                if (update_b) {
+                    if (m_incflo->hasEBFlow()) {
+                      MultiFab phi(*m_incflo->get_velocity_eb()[lev], amrex::make_alias, comp, 1);
+                      m_eb_vel_solve_op->setEBDirichlet(lev, phi, *eta[lev]);
+                    } else {
+                      m_eb_vel_solve_op->setEBHomogDirichlet(lev, *eta[lev]);
+                    }
                 }
             }
 
-            for (int lev = 0; lev <= finest_level; ++lev) {
-                Array<MultiFab,AMREX_SPACEDIM>
-                    b = m_incflo->average_scalar_eta_to_faces(lev, eta_comp, *eta[lev]);
+            if (update_b) {
+                for (int lev = 0; lev <= finest_level; ++lev) {
+                    m_incflo->average_scalar_eta_to_faces(lev, eta_comp, *eta[lev], m_eta_faces[lev]);
 
-                m_eb_vel_solve_op->setBCoeffs(lev, GetArrOfConstPtrs(b), MLMG::Location::FaceCentroid);
+                    m_eb_vel_solve_op->setBCoeffs(lev, GetArrOfConstPtrs(m_eta_faces[lev]), MLMG::Location::FaceCentroid);
+                }
             }
         }
         else
@@ -397,14 +767,17 @@ DiffusionScalarOp::diffuse_vel_components (Vector<MultiFab*> const& vel,
                                             m_incflo->get_diffuse_velocity_bc(Orientation::high,comp));
 
             m_reg_vel_solve_op->setScalars(1.0, dt);
-            for (int lev = 0; lev <= finest_level; ++lev) {
-                m_reg_vel_solve_op->setACoeffs(lev, *density[lev]);
+            if (update_a) {
+                for (int lev = 0; lev <= finest_level; ++lev) {
+                    m_reg_vel_solve_op->setACoeffs(lev, *density[lev]);
+                }
             }
 
-            for (int lev = 0; lev <= finest_level; ++lev) {
-                Array<MultiFab,AMREX_SPACEDIM>
-                    b = m_incflo->average_scalar_eta_to_faces(lev, eta_comp, *eta[lev]);
-                m_reg_vel_solve_op->setBCoeffs(lev, GetArrOfConstPtrs(b));
+            if (update_b) {
+                for (int lev = 0; lev <= finest_level; ++lev) {
+                    m_incflo->average_scalar_eta_to_faces(lev, eta_comp, *eta[lev], m_eta_faces[lev]);
+                    m_reg_vel_solve_op->setBCoeffs(lev, GetArrOfConstPtrs(m_eta_faces[lev]));
+                }
             }
         }
 
@@ -433,7 +806,7 @@ DiffusionScalarOp::diffuse_vel_components (Vector<MultiFab*> const& vel,
                 // m_eb_vel_solve_op->setPhiOnCentroid();
 
                 if ( m_incflo->m_has_mixedBC ) {
-                    auto const robin = m_incflo->make_robinBC_MFs(lev, &phi[lev]);
+                    auto const& robin = m_incflo->get_robinBC_MFs(lev, &phi[lev]);
 
                     m_eb_vel_solve_op->setLevelBC(lev, &phi[lev],
                                                   &robin[0], &robin[1], &robin[2]);
@@ -448,34 +821,24 @@ DiffusionScalarOp::diffuse_vel_components (Vector<MultiFab*> const& vel,
             }
         }
 
+        if (!guess.empty()) {
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                MultiFab::Copy(phi[lev], *guess[lev], comp, 0, 1, 0);
+            }
+        }
+
 #ifdef AMREX_USE_EB
-        MLMG mlmg(m_eb_vel_solve_op ? static_cast<MLLinOp&>(*m_eb_vel_solve_op) : static_cast<MLLinOp&>(*m_reg_vel_solve_op));
+        MLMG& mlmg = get_solve_mlmg(m_vel_solve_mlmg,
+                                    m_eb_vel_solve_op ? static_cast<MLLinOp&>(*m_eb_vel_solve_op)
+                                                      : static_cast<MLLinOp&>(*m_reg_vel_solve_op));
 #else
-        MLMG mlmg(*m_reg_vel_solve_op);
+        MLMG& mlmg = get_solve_mlmg(m_vel_solve_mlmg, *m_reg_vel_solve_op);
 #endif
 
-        // The default bottom solver is BiCG
-        if (m_mg_bottom_solver == "smoother")
-        {
-            mlmg.setBottomSolver(MLMG::BottomSolver::smoother);
-        }
-        else if (m_mg_bottom_solver == "hypre")
-        {
-            mlmg.setBottomSolver(MLMG::BottomSolver::hypre);
-        }
-        // Maximum iterations for MultiGrid / ConjugateGradients
-        mlmg.setMaxIter(m_mg_max_iter);
-        mlmg.setMaxFmgIter(m_mg_max_fmg_iter);
-        mlmg.setBottomMaxIter(m_mg_bottom_maxiter);
-
-        // Verbosity for MultiGrid / ConjugateGradients
-        mlmg.setVerbose(m_mg_verbose);
-        mlmg.setBottomVerbose(m_mg_bottom_verbose);
-
-        mlmg.setPreSmooth(m_num_pre_smooth);
-        mlmg.setPostSmooth(m_num_post_smooth);
-
         mlmg.solve(GetVecOfPtrs(phi), GetVecOfConstPtrs(rhs), m_mg_rtol, m_mg_atol);
+        m_incflo->m_telemetry.record_solve("diffuse_vel_components", mlmg.getNumIters(), mlmg.getFinalResidual());
+        m_incflo->m_telemetry.set_solve_guess(guess.empty() ? 0 : m_incflo->diffusion_guess_points(),
+                                              mlmg.getInitResidual());
     }
 }
 
@@ -516,20 +879,23 @@ void DiffusionScalarOp::compute_laps (Vector<MultiFab*> const& a_laps,
                 m_eb_scal_apply_op->setScalars(0.0, -1.0);
             }
 
+            bool const update_b = m_scal_apply_coeffs.update_b(tra_eta_version(), eta_comp);
+
             Vector<MultiFab> laps_comp;
             Vector<MultiFab> scalar_comp;
             for (int lev = 0; lev <= finest_level; ++lev) {
                 laps_comp.emplace_back(laps_tmp[lev],amrex::make_alias,comp,1);
                 scalar_comp.emplace_back(*a_scalar[lev],amrex::make_alias,comp,1);
 
-                Array<MultiFab,AMREX_SPACEDIM>
-                    b = m_incflo->average_scalar_eta_to_faces(lev, eta_comp, *a_eta[lev]);
+                if (update_b) {
+                    m_incflo->average_scalar_eta_to_faces(lev, eta_comp, *a_eta[lev], m_eta_faces[lev]);
 
-                m_eb_scal_apply_op->setBCoeffs(lev, GetArrOfConstPtrs(b), MLMG::Location::FaceCentroid);
+                    m_eb_scal_apply_op->setBCoeffs(lev, GetArrOfConstPtrs(m_eta_faces[lev]), MLMG::Location::FaceCentroid);
+                }
 
                 if ( m_incflo->m_has_mixedBC ) {
 
-                    auto const robin = m_incflo->make_robinBC_MFs(lev, &scalar_comp[lev]);
+                    auto const& robin = m_incflo->get_robinBC_MFs(lev, &scalar_comp[lev]);
 
                     m_eb_scal_apply_op->setLevelBC(lev, &scalar_comp[lev],
                                                    &robin[0], &robin[1], &robin[2]);
@@ -539,8 +905,8 @@ void DiffusionScalarOp::compute_laps (Vector<MultiFab*> const& a_laps,
                 }
             }
 
-            MLMG mlmg(*m_eb_scal_apply_op);
-            mlmg.apply(GetVecOfPtrs(laps_comp), GetVecOfPtrs(scalar_comp));
+            if (!m_scal_apply_mlmg) { m_scal_apply_mlmg = std::make_unique<MLMG>(*m_eb_scal_apply_op); }
+            m_scal_apply_mlmg->apply(GetVecOfPtrs(laps_comp), GetVecOfPtrs(scalar_comp));
         }
 
         for(int lev = 0; lev <= finest_level; lev++)
@@ -563,20 +929,22 @@ void DiffusionScalarOp::compute_laps (Vector<MultiFab*> const& a_laps,
 
             int eta_comp = comp;
 
+            bool const update_b = m_scal_apply_coeffs.update_b(tra_eta_version(), eta_comp);
+
             Vector<MultiFab> laps_comp;
             Vector<MultiFab> scalar_comp;
             for (int lev = 0; lev <= finest_level; ++lev) {
                 laps_comp.emplace_back(*a_laps[lev],amrex::make_alias,comp,1);
                 scalar_comp.emplace_back(*a_scalar[lev],amrex::make_alias,comp,1);
-                Array<MultiFab,AMREX_SPACEDIM>
-                    b = m_incflo->average_scalar_eta_to_faces(lev, eta_comp, *a_eta[lev]);
-
-                m_reg_scal_apply_op->setBCoeffs(lev, GetArrOfConstPtrs(b));
+                if (update_b) {
+                    m_incflo->average_scalar_eta_to_faces(lev, eta_comp, *a_eta[lev], m_eta_faces[lev]);
+                    m_reg_scal_apply_op->setBCoeffs(lev, GetArrOfConstPtrs(m_eta_faces[lev]));
+                }
                 m_reg_scal_apply_op->setLevelBC(lev, &scalar_comp[lev]);
             }
 
-            MLMG mlmg(*m_reg_scal_apply_op);
-            mlmg.apply(GetVecOfPtrs(laps_comp), GetVecOfPtrs(scalar_comp));
+            if (!m_scal_apply_mlmg) { m_scal_apply_mlmg = std::make_unique<MLMG>(*m_reg_scal_apply_op); }
+            m_scal_apply_mlmg->apply(GetVecOfPtrs(laps_comp), GetVecOfPtrs(scalar_comp));
         }
     }
 }
@@ -615,8 +983,15 @@ void DiffusionScalarOp::compute_divtau (Vector<MultiFab*> const& a_divtau,
             divtau_tmp[lev].setVal(0.0);
         }
 
-        for (int lev = 0; lev <= finest_level; ++lev) {
-            m_eb_vel_apply_op->setEBHomogDirichlet(lev, *a_eta[lev]);
+        int eta_comp = 0;
+
+        // The EB and face coefficients are shared by all the components
+        bool const update_b = m_vel_apply_coeffs.update_b(vel_eta_version(), eta_comp);
+
+        if (update_b) {
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                m_eb_vel_apply_op->setEBHomogDirichlet(lev, *a_eta[lev]);
+            }
         }
         // We want to return div (mu grad)) phi
         m_eb_vel_apply_op->setScalars(0.0, -1.0);
@@ -624,8 +999,6 @@ void DiffusionScalarOp::compute_divtau (Vector<MultiFab*> const& a_divtau,
         // For when we use the stencil for centroid values
         // m_eb_vel_apply_op->setPhiOnCentroid();
 
-        int eta_comp = 0;
-
         for (int comp = 0; comp < a_divtau[0]->nComp(); ++comp)
         {
             Vector<MultiFab> divtau_single;
@@ -646,7 +1019,7 @@ void DiffusionScalarOp::compute_divtau (Vector<MultiFab*> const& a_divtau,
                 vel_single.emplace_back(       vel[lev],amrex::make_alias,comp,1);
 
                 if ( m_incflo->m_has_mixedBC ) {
-                    auto const robin = m_incflo->make_robinBC_MFs(lev, &vel_single[lev]);
+                    auto const& robin = m_incflo->get_robinBC_MFs(lev, &vel_single[lev]);
 
                     m_eb_vel_apply_op->setLevelBC(lev, &vel_single[lev],
                                                   &robin[0], &robin[1], &robin[2]);
@@ -655,14 +1028,14 @@ void DiffusionScalarOp::compute_divtau (Vector<MultiFab*> const& a_divtau,
                     m_eb_vel_apply_op->setLevelBC(lev, &vel_single[lev]);
                 }
 
-                Array<MultiFab,AMREX_SPACEDIM> b =
-                    m_incflo->average_scalar_eta_to_faces(lev, eta_comp, *a_eta[lev]);
-                m_eb_vel_apply_op->setBCoeffs(lev, GetArrOfConstPtrs(b), MLMG::Location::FaceCentroid);
+                if (update_b && comp == 0) {
+                    m_incflo->average_scalar_eta_to_faces(lev, eta_comp, *a_eta[lev], m_eta_faces[lev]);
+                    m_eb_vel_apply_op->setBCoeffs(lev, GetArrOfConstPtrs(m_eta_faces[lev]), MLMG::Location::FaceCentroid);
+                }
             }
 
-            MLMG mlmg(*m_eb_vel_apply_op);
-
-            mlmg.apply(GetVecOfPtrs(divtau_single), GetVecOfPtrs(vel_single));
+            if (!m_vel_apply_mlmg) { m_vel_apply_mlmg = std::make_unique<MLMG>(*m_eb_vel_apply_op); }
+            m_vel_apply_mlmg->apply(GetVecOfPtrs(divtau_single), GetVecOfPtrs(vel_single));
         }
 
         for(int lev = 0; lev <= finest_level; lev++)
@@ -682,14 +1055,13 @@ void DiffusionScalarOp::compute_divtau (Vector<MultiFab*> const& a_divtau,
         m_reg_vel_apply_op->setScalars(0.0, -1.0);
 
         int eta_comp = 0;
-        Vector<MultiFab> divtau_single;
-        Vector<MultiFab>    vel_single;
 
-        for (int lev = 0; lev <= finest_level; ++lev)
-        {
-            Array<MultiFab,AMREX_SPACEDIM>
-                b = m_incflo->average_scalar_eta_to_faces(lev, eta_comp, *a_eta[lev]);
-            m_reg_vel_apply_op->setBCoeffs(lev, GetArrOfConstPtrs(b));
+        if (m_vel_apply_coeffs.update_b(vel_eta_version(), eta_comp)) {
+            for (int lev = 0; lev <= finest_level; ++lev)
+            {
+                m_incflo->average_scalar_eta_to_faces(lev, eta_comp, *a_eta[lev], m_eta_faces[lev]);
+                m_reg_vel_apply_op->setBCoeffs(lev, GetArrOfConstPtrs(m_eta_faces[lev]));
+            }
         }
 
         for (int comp = 0; comp < a_divtau[0]->nComp(); ++comp)
@@ -699,6 +1071,8 @@ void DiffusionScalarOp::compute_divtau (Vector<MultiFab*> const& a_divtau,
             m_reg_vel_apply_op->setDomainBC(m_incflo->get_diffuse_velocity_bc(Orientation::low ,comp),
                                         m_incflo->get_diffuse_velocity_bc(Orientation::high,comp));
 
+            Vector<MultiFab> divtau_single;
+            Vector<MultiFab>    vel_single;
             for (int lev = 0; lev <= finest_level; ++lev) {
                 divtau_single.emplace_back(*a_divtau[lev],amrex::make_alias,comp,1);
                    vel_single.emplace_back(      vel[lev],amrex::make_alias,comp,1);
@@ -706,8 +1080,8 @@ void DiffusionScalarOp::compute_divtau (Vector<MultiFab*> const& a_divtau,
                 m_reg_vel_apply_op->setLevelBC(lev, &vel_single[lev]);
             }
 
-            MLMG mlmg(*m_reg_vel_apply_op);
-            mlmg.apply(GetVecOfPtrs(divtau_single), GetVecOfPtrs(vel_single));
+            if (!m_vel_apply_mlmg) { m_vel_apply_mlmg = std::make_unique<MLMG>(*m_reg_vel_apply_op); }
+            m_vel_apply_mlmg->apply(GetVecOfPtrs(divtau_single), GetVecOfPtrs(vel_single));
         }
     }
 
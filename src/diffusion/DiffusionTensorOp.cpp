@@ -16,6 +16,8 @@ DiffusionTensorOp::DiffusionTensorOp (incflo* a_incflo)
 
     int finest_level = m_incflo->finestLevel();
 
+    m_eta_faces.resize(finest_level+1);
+
     LPInfo info_solve;
     info_solve.setMaxCoarseningLevel(m_mg_max_coarsening_level);
     LPInfo info_apply;
@@ -39,7 +41,7 @@ DiffusionTensorOp::DiffusionTensorOp (incflo* a_incflo)
                                        m_incflo->get_diffuse_tensor_bc(Orientation::high));
         }
 
-        if (m_incflo->need_divtau() || m_incflo->useTensorCorrection())
+        if (m_incflo->need_diffusion_apply_ops() || m_incflo->useTensorCorrection())
         {
             m_eb_apply_op = std::make_unique<MLEBTensorOp>(m_incflo->Geom(0,finest_level),
                                                  m_incflo->boxArray(0,finest_level),
@@ -65,7 +67,7 @@ DiffusionTensorOp::DiffusionTensorOp (incflo* a_incflo)
                                         m_incflo->get_diffuse_tensor_bc(Orientation::high));
         }
 
-        if (m_incflo->need_divtau() || m_incflo->useTensorCorrection())
+        if (m_incflo->need_diffusion_apply_ops() || m_incflo->useTensorCorrection())
         {
             m_reg_apply_op = std::make_unique<MLTensorOp>(m_incflo->Geom(0,finest_level),
                                                 m_incflo->boxArray(0,finest_level),
@@ -105,8 +107,11 @@ void
 DiffusionTensorOp::diffuse_velocity (Vector<MultiFab*> const& velocity,
                                      Vector<MultiFab*> const& density,
                                      Vector<MultiFab const*> const& eta,
-                                     Real dt)
+                                     Real dt,
+                                     Vector<MultiFab const*> const& guess)
 {
+    Telemetry::Timer timer(m_incflo->m_telemetry, Telemetry::Phase::Diffusion);
+
     //
     //      alpha a - beta div ( b grad )   <--->   rho - dt div ( mu grad )
     //
@@ -123,6 +128,15 @@ DiffusionTensorOp::diffuse_velocity (Vector<MultiFab*> const& velocity,
 
     const int finest_level = m_incflo->finestLevel();
 
+    // The coefficients are only set if rho or eta changed since the last call
+    bool const update_a = m_solve_coeffs.update_a(m_incflo->density_version());
+#ifdef AMREX_USE_EB
+    // The EB inflow velocity is set together with eta
+    bool const update_b = m_solve_coeffs.update_b(m_incflo->hasEBFlow() ? -1 : m_incflo->vel_eta_version());
+#else
+    bool const update_b = m_solve_coeffs.update_b(m_incflo->vel_eta_version());
+#endif
+
 #ifdef AMREX_USE_EB
     if (m_eb_solve_op)
     {
@@ -131,16 +145,20 @@ DiffusionTensorOp::diffuse_velocity (Vector<MultiFab*> const& velocity,
 
         m_eb_solve_op->setScalars(1.0, dt);
         for (int lev = 0; lev <= finest_level; ++lev) {
-            m_eb_solve_op->setACoeffs(lev, *density[lev]);
+            if (update_a) {
+                m_eb_solve_op->setACoeffs(lev, *density[lev]);
+            }
 
-            Array<MultiFab,AMREX_SPACEDIM> b = m_incflo->average_velocity_eta_to_faces(lev, *eta[lev]);
+            if (update_b) {
+                m_incflo->average_velocity_eta_to_faces(lev, *eta[lev], m_eta_faces[lev]);
 
-            m_eb_solve_op->setShearViscosity(lev, GetArrOfConstPtrs(b), MLMG::Location::FaceCentroid);
+                m_eb_solve_op->setShearViscosity(lev, GetArrOfConstPtrs(m_eta_faces[lev]), MLMG::Location::FaceCentroid);
 
-            if (m_incflo->hasEBFlow()) {
-               m_eb_solve_op->setEBShearViscosityWithInflow(lev, *eta[lev], *(m_incflo->get_velocity_eb()[lev]));
-            } else {
-               m_eb_solve_op->setEBShearViscosity(lev, *eta[lev]);
+                if (m_incflo->hasEBFlow()) {
+                   m_eb_solve_op->setEBShearViscosityWithInflow(lev, *eta[lev], *(m_incflo->get_velocity_eb()[lev]));
+                } else {
+                   m_eb_solve_op->setEBShearViscosity(lev, *eta[lev]);
+                }
             }
         }
     }
@@ -149,9 +167,13 @@ DiffusionTensorOp::diffuse_velocity (Vector<MultiFab*> const& velocity,
     {
         m_reg_solve_op->setScalars(1.0, dt);
         for (int lev = 0; lev <= finest_level; ++lev) {
-            m_reg_solve_op->setACoeffs(lev, *density[lev]);
-            Array<MultiFab,AMREX_SPACEDIM> b = m_incflo->average_velocity_eta_to_faces(lev, *eta[lev]);
-            m_reg_solve_op->setShearViscosity(lev, GetArrOfConstPtrs(b));
+            if (update_a) {
+                m_reg_solve_op->setACoeffs(lev, *density[lev]);
+            }
+            if (update_b) {
+                m_incflo->average_velocity_eta_to_faces(lev, *eta[lev], m_eta_faces[lev]);
+                m_reg_solve_op->setShearViscosity(lev, GetArrOfConstPtrs(m_eta_faces[lev]));
+            }
         }
     }
 
@@ -184,35 +206,54 @@ DiffusionTensorOp::diffuse_velocity (Vector<MultiFab*> const& velocity,
         }
     }
 
+    // The rhs and the boundary values are set, so the provisional velocity
+    // can now be replaced by the initial guess
+    if (!guess.empty()) {
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            MultiFab::Copy(*velocity[lev], *guess[lev], 0, 0, AMREX_SPACEDIM, 0);
+        }
+    }
+
+    // The hypre bottom solver keeps the matrix of the coarsest level until the
+    // operator reports that it needs an update, which setScalars does not do,
+    // so with hypre a new MLMG is made for every solve (with the new dt)
+    if (!m_solve_mlmg || m_bottom_solver == "hypre")
+    {
 #ifdef AMREX_USE_EB
-    MLMG mlmg(m_eb_solve_op ? static_cast<MLLinOp&>(*m_eb_solve_op)
-              :               static_cast<MLLinOp&>(*m_reg_solve_op));
+        m_solve_mlmg = std::make_unique<MLMG>(m_eb_solve_op ? static_cast<MLLinOp&>(*m_eb_solve_op)
+                                              :               static_cast<MLLinOp&>(*m_reg_solve_op));
 #else
-    MLMG mlmg(*m_reg_solve_op);
+        m_solve_mlmg = std::make_unique<MLMG>(*m_reg_solve_op);
 #endif
+        MLMG& mlmg = *m_solve_mlmg;
 
-    // The default bottom solver is BiCG
-    if (m_bottom_solver == "smoother")
-    {
-        mlmg.setBottomSolver(MLMG::BottomSolver::smoother);
-    }
-    else if (m_bottom_solver == "hypre")
-    {
-        mlmg.setBottomSolver(MLMG::BottomSolver::hypre);
-    }
-    // Maximum iterations for MultiGrid / ConjugateGradients
-    mlmg.setMaxIter(m_mg_max_iter);
-    mlmg.setMaxFmgIter(m_mg_max_fmg_iter);
-    mlmg.setBottomMaxIter(m_mg_bottom_maxiter);
+        // The default bottom solver is BiCG
+        if (m_bottom_solver == "smoother")
+        {
+            mlmg.setBottomSolver(MLMG::BottomSolver::smoother);
+        }
+        else if (m_bottom_solver == "hypre")
+        {
+            mlmg.setBottomSolver(MLMG::BottomSolver::hypre);
+        }
+        // Maximum iterations for MultiGrid / ConjugateGradients
+        mlmg.setMaxIter(m_mg_max_iter);
+        mlmg.setMaxFmgIter(m_mg_max_fmg_iter);
+        mlmg.setBottomMaxIter(m_mg_bottom_maxiter);
 
-    // Verbosity for MultiGrid / ConjugateGradients
-    mlmg.setVerbose(m_mg_verbose);
-    mlmg.setBottomVerbose(m_mg_bottom_verbose);
+        // Verbosity for MultiGrid / ConjugateGradients
+        mlmg.setVerbose(m_mg_verbose);
+        mlmg.setBottomVerbose(m_mg_bottom_verbose);
 
-    mlmg.setPreSmooth(m_num_pre_smooth);
-    mlmg.setPostSmooth(m_num_post_smooth);
+        mlmg.setPreSmooth(m_num_pre_smooth);
+        mlmg.setPostSmooth(m_num_post_smooth);
+    }
+    MLMG& mlmg = *m_solve_mlmg;
 
     mlmg.solve(velocity, GetVecOfConstPtrs(rhs), m_mg_rtol, m_mg_atol);
+    m_incflo->m_telemetry.record_solve("diffuse_velocity", mlmg.getNumIters(), mlmg.getFinalResidual());
+    m_incflo->m_telemetry.set_solve_guess(guess.empty() ? 0 : m_incflo->diffusion_guess_points(),
+                                          mlmg.getInitResidual());
 }
 
 void DiffusionTensorOp::compute_divtau (Vector<MultiFab*> const& a_divtau,
@@ -252,23 +293,30 @@ void DiffusionTensorOp::compute_divtau (Vector<MultiFab*> const& a_divtau,
         // For when we use the stencil for centroid values
         // m_eb_apply_op->setPhiOnCentroid();
 
+        bool const update_a = m_apply_coeffs.update_a(m_incflo->density_version());
+        bool const update_b = m_apply_coeffs.update_b(m_incflo->hasEBFlow() ? -1 : m_incflo->vel_eta_version());
+
         for (int lev = 0; lev <= finest_level; ++lev) {
-            m_eb_apply_op->setACoeffs(lev, *a_density[lev]);
+            if (update_a) {
+                m_eb_apply_op->setACoeffs(lev, *a_density[lev]);
+            }
 
-            Array<MultiFab,AMREX_SPACEDIM> b = m_incflo->average_velocity_eta_to_faces(lev, *a_eta[lev]);
+            if (update_b) {
+                m_incflo->average_velocity_eta_to_faces(lev, *a_eta[lev], m_eta_faces[lev]);
 
-            m_eb_apply_op->setShearViscosity(lev, GetArrOfConstPtrs(b), MLMG::Location::FaceCentroid);
+                m_eb_apply_op->setShearViscosity(lev, GetArrOfConstPtrs(m_eta_faces[lev]), MLMG::Location::FaceCentroid);
 
-            if (m_incflo->hasEBFlow()) {
-               m_eb_apply_op->setEBShearViscosityWithInflow(lev, *a_eta[lev], *(m_incflo->get_velocity_eb()[lev]));
-            } else {
-               m_eb_apply_op->setEBShearViscosity(lev, *a_eta[lev]);
+                if (m_incflo->hasEBFlow()) {
+                   m_eb_apply_op->setEBShearViscosityWithInflow(lev, *a_eta[lev], *(m_incflo->get_velocity_eb()[lev]));
+                } else {
+                   m_eb_apply_op->setEBShearViscosity(lev, *a_eta[lev]);
+                }
             }
             m_eb_apply_op->setLevelBC(lev, &velocity[lev]);
         }
 
-        MLMG mlmg(*m_eb_apply_op);
-        mlmg.apply(GetVecOfPtrs(divtau_tmp), GetVecOfPtrs(velocity));
+        if (!m_apply_mlmg) { m_apply_mlmg = std::make_unique<MLMG>(*m_eb_apply_op); }
+        m_apply_mlmg->apply(GetVecOfPtrs(divtau_tmp), GetVecOfPtrs(velocity));
 
         for(int lev = 0; lev <= finest_level; lev++)
         {
@@ -283,15 +331,21 @@ void DiffusionTensorOp::compute_divtau (Vector<MultiFab*> const& a_divtau,
     {
         // We want to return div (mu grad)) phi
         m_reg_apply_op->setScalars(0.0, -1.0);
+        bool const update_a = m_apply_coeffs.update_a(m_incflo->density_version());
+        bool const update_b = m_apply_coeffs.update_b(m_incflo->vel_eta_version());
         for (int lev = 0; lev <= finest_level; ++lev) {
-            m_reg_apply_op->setACoeffs(lev, *a_density[lev]);
-            Array<MultiFab,AMREX_SPACEDIM> b = m_incflo->average_velocity_eta_to_faces(lev, *a_eta[lev]);
-            m_reg_apply_op->setShearViscosity(lev, GetArrOfConstPtrs(b));
+            if (update_a) {
+                m_reg_apply_op->setACoeffs(lev, *a_density[lev]);
+            }
+            if (update_b) {
+                m_incflo->average_velocity_eta_to_faces(lev, *a_eta[lev], m_eta_faces[lev]);
+                m_reg_apply_op->setShearViscosity(lev, GetArrOfConstPtrs(m_eta_faces[lev]));
+            }
             m_reg_apply_op->setLevelBC(lev, &velocity[lev]);
         }
 
-        MLMG mlmg(*m_reg_apply_op);
-        mlmg.apply(a_divtau, GetVecOfPtrs(velocity));
+        if (!m_apply_mlmg) { m_apply_mlmg = std::make_unique<MLMG>(*m_reg_apply_op); }
+        m_apply_mlmg->apply(a_divtau, GetVecOfPtrs(velocity));
     }
 
     bool advect_momentum = m_incflo->AdvectMomentum();
@@ -68,7 +68,8 @@ incflo::diffuse_scalar(Vector<MultiFab      *> const& scalar,
                        Vector<MultiFab const*> const& eta,
                        Real dt_diff)
 {
-    get_diffusion_scalar_op()->diffuse_scalar(scalar, density, eta, dt_diff);
+    get_diffusion_scalar_op()->diffuse_scalar(scalar, density, eta, dt_diff,
+                                              diffusion_initial_guess(true));
 }
 
 
@@ -78,13 +79,15 @@ incflo::diffuse_velocity(Vector<MultiFab      *> const& vel,
                          Vector<MultiFab const*> const& eta,
                          Real dt_diff)
 {
+    auto const guess = diffusion_initial_guess(false);
+
     if (use_tensor_correction) {
         amrex::Print() << " \n ... diffuse components separately but with tensor terms added explicitly... " << std::endl;
-        get_diffusion_scalar_op()->diffuse_vel_components(vel, density, eta, dt_diff);
+        get_diffusion_scalar_op()->diffuse_vel_components(vel, density, eta, dt_diff, guess);
     } else if (use_tensor_solve) {
-        get_diffusion_tensor_op()->diffuse_velocity(vel, density, eta, dt_diff);
+        get_diffusion_tensor_op()->diffuse_velocity(vel, density, eta, dt_diff, guess);
     } else {
-        get_diffusion_scalar_op()->diffuse_vel_components(vel, density, eta, dt_diff);
+        get_diffusion_scalar_op()->diffuse_vel_components(vel, density, eta, dt_diff, guess);
     }
 }
 
@@ -258,54 +261,55 @@ incflo::get_diffuse_scalar_bc (Orientation::Side side, const int* bcr) const noe
     return r;
 }
 
-Array<MultiFab,AMREX_SPACEDIM>
-incflo::average_velocity_eta_to_faces (int lev, MultiFab const& cc_eta) const
+namespace {
+
+// (Re)define the face MultiFabs fc unless they already match cc_eta and ncomp
+void define_eta_faces (Array<MultiFab,AMREX_SPACEDIM>& fc, MultiFab const& cc_eta, int ncomp)
 {
-    const auto& ba = cc_eta.boxArray();
-    const auto& dm = cc_eta.DistributionMap();
-    const auto& fact = cc_eta.Factory();
-    Array<MultiFab,AMREX_SPACEDIM> r{AMREX_D_DECL(MultiFab(amrex::convert(ba,IntVect::TheDimensionVector(0)),
-                                              dm, 1, 0, MFInfo(), fact),
-                                     MultiFab(amrex::convert(ba,IntVect::TheDimensionVector(1)),
-                                              dm, 1, 0, MFInfo(), fact),
-                                     MultiFab(amrex::convert(ba,IntVect::TheDimensionVector(2)),
-                                              dm, 1, 0, MFInfo(), fact))};
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        BoxArray const ba = amrex::convert(cc_eta.boxArray(), IntVect::TheDimensionVector(idim));
+        if (!fc[idim].ok() || fc[idim].nComp() != ncomp || fc[idim].boxArray() != ba ||
+            fc[idim].DistributionMap() != cc_eta.DistributionMap())
+        {
+            fc[idim] = MultiFab(ba, cc_eta.DistributionMap(), ncomp, 0, MFInfo(), cc_eta.Factory());
+        }
+    }
+}
+
+}
+
+void
+incflo::average_velocity_eta_to_faces (int lev, MultiFab const& cc_eta,
+                                       Array<MultiFab,AMREX_SPACEDIM>& fc) const
+{
+    define_eta_faces(fc, cc_eta, 1);
 
 #ifdef AMREX_USE_EB
     // Note we use the scalar bc's here only to know when the bc is ext_dir
     //      (this should be the same for scalar and eta)
-    EB_interp_CellCentroid_to_FaceCentroid (cc_eta, GetArrOfPtrs(r), 0, 0, 1, geom[lev],
+    EB_interp_CellCentroid_to_FaceCentroid (cc_eta, GetArrOfPtrs(fc), 0, 0, 1, geom[lev],
                                             get_tracer_bcrec());
-    // amrex::average_cellcenter_to_face(GetArrOfPtrs(r), cc_eta, Geom(lev));
+    // amrex::average_cellcenter_to_face(GetArrOfPtrs(fc), cc_eta, Geom(lev));
 #else
-    amrex::average_cellcenter_to_face(GetArrOfPtrs(r), cc_eta, Geom(lev));
+    amrex::average_cellcenter_to_face(GetArrOfPtrs(fc), cc_eta, Geom(lev));
 #endif
 
-    fixup_eta_on_domain_faces(lev, r, cc_eta);
-    return r;
+    fixup_eta_on_domain_faces(lev, fc, cc_eta);
 }
 
-Array<MultiFab,AMREX_SPACEDIM>
-incflo::average_scalar_eta_to_faces (int lev, int comp, MultiFab const& cc_eta) const
+void
+incflo::average_scalar_eta_to_faces (int lev, int comp, MultiFab const& cc_eta,
+                                     Array<MultiFab,AMREX_SPACEDIM>& fc, int ncomp) const
 {
-    const auto& ba = cc_eta.boxArray();
-    const auto& dm = cc_eta.DistributionMap();
-    const auto& fact = cc_eta.Factory();
-    MultiFab cc(cc_eta, amrex::make_alias, comp, 1);
-    Array<MultiFab,AMREX_SPACEDIM> r{AMREX_D_DECL(MultiFab(amrex::convert(ba,IntVect::TheDimensionVector(0)),
-                                              dm, 1, 0, MFInfo(), fact),
-                                     MultiFab(amrex::convert(ba,IntVect::TheDimensionVector(1)),
-                                              dm, 1, 0, MFInfo(), fact),
-                                     MultiFab(amrex::convert(ba,IntVect::TheDimensionVector(2)),
-                                              dm, 1, 0, MFInfo(), fact))};
+    MultiFab cc(cc_eta, amrex::make_alias, comp, ncomp);
+    define_eta_faces(fc, cc_eta, ncomp);
 #ifdef AMREX_USE_EB
-    EB_interp_CellCentroid_to_FaceCentroid (cc, GetArrOfPtrs(r), 0, 0, 1, geom[lev],
+    EB_interp_CellCentroid_to_FaceCentroid (cc, GetArrOfPtrs(fc), 0, 0, ncomp, geom[lev],
                                             get_tracer_bcrec());
 #else
-    amrex::average_cellcenter_to_face(GetArrOfPtrs(r), cc, Geom(lev));
+    amrex::average_cellcenter_to_face(GetArrOfPtrs(fc), cc, Geom(lev));
 #endif
-    fixup_eta_on_domain_faces(lev, r, cc);
-    return r;
+    fixup_eta_on_domain_faces(lev, fc, cc);
 }
 
 void
@@ -314,6 +318,7 @@ incflo::fixup_eta_on_domain_faces (int lev, Array<MultiFab,AMREX_SPACEDIM>& fc,
 {
     const Geometry& gm = Geom(lev);
     const Box& domain = gm.Domain();
+    const int ncomp = fc[0].nComp();
     MFItInfo mfi_info{};
     if (Gpu::notInLaunchRegion()) mfi_info.SetDynamic(true);
 #ifdef _OPENMP
@@ -327,17 +332,17 @@ incflo::fixup_eta_on_domain_faces (int lev, Array<MultiFab,AMREX_SPACEDIM>& fc,
         if (!gm.isPeriodic(idim)) {
             Array4<Real> const& fca = fc[idim].array(mfi);
             if (bx.smallEnd(idim) == domain.smallEnd(idim)) {
-                ParallelFor(amrex::bdryLo(bx, idim),
-                [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                ParallelFor(amrex::bdryLo(bx, idim), ncomp,
+                [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
                 {
-                    fca(i,j,k) = cca(i,j,k);
+                    fca(i,j,k,n) = cca(i,j,k,n);
                 });
             }
             if (bx.bigEnd(idim) == domain.bigEnd(idim)) {
-                ParallelFor(amrex::bdryHi(bx, idim),
-                [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                ParallelFor(amrex::bdryHi(bx, idim), ncomp,
+                [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
                 {
-                    fca(i,j,k) = cca(i-1,j,k);
+                    fca(i,j,k,n) = cca(i-1,j,k,n);
                 });
             }
         }
@@ -346,17 +351,17 @@ incflo::fixup_eta_on_domain_faces (int lev, Array<MultiFab,AMREX_SPACEDIM>& fc,
         if (!gm.isPeriodic(idim)) {
             Array4<Real> const& fca = fc[idim].array(mfi);
             if (bx.smallEnd(idim) == domain.smallEnd(idim)) {
-                ParallelFor(amrex::bdryLo(bx, idim),
-                [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                ParallelFor(amrex::bdryLo(bx, idim), ncomp,
+                [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
                 {
-                    fca(i,j,k) = cca(i,j,k);
+                    fca(i,j,k,n) = cca(i,j,k,n);
                 });
             }
             if (bx.bigEnd(idim) == domain.bigEnd(idim)) {
-                ParallelFor(amrex::bdryHi(bx, idim),
-                [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                ParallelFor(amrex::bdryHi(bx, idim), ncomp,
+                [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
                 {
-                    fca(i,j,k) = cca(i,j-1,k);
+                    fca(i,j,k,n) = cca(i,j-1,k,n);
                 });
             }
         }
@@ -366,17 +371,17 @@ incflo::fixup_eta_on_domain_faces (int lev, Array<MultiFab,AMREX_SPACEDIM>& fc,
         if (!gm.isPeriodic(idim)) {
             Array4<Real> const& fca = fc[idim].array(mfi);
             if (bx.smallEnd(idim) == domain.smallEnd(idim)) {
-                ParallelFor(amrex::bdryLo(bx, idim),
-                [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                ParallelFor(amrex::bdryLo(bx, idim), ncomp,
+                [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
                 {
-                    fca(i,j,k) = cca(i,j,k);
+                    fca(i,j,k,n) = cca(i,j,k,n);
                 });
             }
             if (bx.bigEnd(idim) == domain.bigEnd(idim)) {
-                ParallelFor(amrex::bdryHi(bx, idim),
-                [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                ParallelFor(amrex::bdryHi(bx, idim), ncomp,
+                [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
                 {
-                    fca(i,j,k) = cca(i,j,k-1);
+                    fca(i,j,k,n) = cca(i,j,k-1,n);
                 });
             }
         }
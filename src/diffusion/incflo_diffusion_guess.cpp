@@ -0,0 +1,118 @@
+#include <incflo.H>
+
+#include <algorithm>
+
+using namespace amrex;
+
+//
+// Extrapolated initial guess of the implicit diffusion solves.
+//
+// The right hand side of the solves is built from the provisional state u*,
+// which is also what MLMG starts from. With diffusion_guess_order = 2 (or 3)
+// the solver starts instead from the polynomial through the old state u^n and
+// the states of the previous steps u^{n-1} (and u^{n-2}), evaluated at the new
+// time. With a nearly constant dt this is much closer to u^{n+1}.
+//
+// The previous states are kept in the scratch pool. Until enough of them have
+// been saved (at the start and after a regrid) the guess is of lower order,
+// or the provisional state is used.
+//
+
+namespace {
+
+std::string hist_name (bool tracer, int i)
+{
+    return (tracer ? "tra_hist" : "vel_hist") + std::to_string(i);
+}
+
+}
+
+int
+incflo::diffusion_guess_points () const
+{
+    if (m_diffusion_guess.order < 2) { return 0; }
+    int const npts = std::min(m_diffusion_guess.order, m_diffusion_guess.nhist + 1);
+    return (npts >= 2) ? npts : 0;
+}
+
+Vector<MultiFab const*>
+incflo::diffusion_initial_guess (bool tracer)
+{
+    int const npts = diffusion_guess_points();
+    if (npts == 0) { return {}; }
+
+    BL_PROFILE("incflo::diffusion_initial_guess()");
+
+    // Lagrange weights of u^n, u^{n-1} and u^{n-2} at the new time
+    Array<Real,3> const t{m_t_old[0], m_diffusion_guess.time[0], m_diffusion_guess.time[1]};
+    Real const t_new = m_t_new[0];
+    Array<Real,3> w{};
+    for (int i = 0; i < npts; ++i) {
+        w[i] = Real(1.0);
+        for (int j = 0; j < npts; ++j) {
+            if (j != i) { w[i] *= (t_new - t[j]) / (t[i] - t[j]); }
+        }
+    }
+
+    int const ncomp = tracer ? m_ntrac : AMREX_SPACEDIM;
+    auto guess = get_scratch(tracer ? "tra_guess" : "vel_guess", IndexType::TheCellType(), ncomp, 0);
+    auto hist0 = get_scratch(hist_name(tracer,0), IndexType::TheCellType(), ncomp, 0);
+    Vector<MultiFab*> hist1;
+    if (npts == 3) {
+        hist1 = get_scratch(hist_name(tracer,1), IndexType::TheCellType(), ncomp, 0);
+    }
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        auto const& ld = *m_leveldata[lev];
+        MultiFab const& old = tracer ? ld.tracer_o : ld.velocity_o;
+        MultiFab::LinComb(*guess[lev], w[0], old, 0, w[1], *hist0[lev], 0, 0, ncomp, 0);
+        if (npts == 3) {
+            MultiFab::Saxpy(*guess[lev], w[2], *hist1[lev], 0, 0, ncomp, 0);
+        }
+    }
+
+    return GetVecOfConstPtrs(guess);
+}
+
+void
+incflo::save_diffusion_history ()
+{
+    if (m_diffusion_guess.order < 2 ||
+        (m_diff_type != DiffusionType::Implicit && m_diff_type != DiffusionType::Crank_Nicolson))
+    {
+        return;
+    }
+
+    BL_PROFILE("incflo::save_diffusion_history()");
+
+    // The saved states must be at distinct earlier times
+    if (m_diffusion_guess.nhist > 0 && m_t_old[0] <= m_diffusion_guess.time[0]) {
+        m_diffusion_guess.nhist = 0;
+    }
+
+    // The old state of this step becomes the newest saved state; with two
+    // saved states the storage of the oldest one is reused
+    int const nkeep = m_diffusion_guess.order - 1;
+    for (bool tracer : {false, true})
+    {
+        if (tracer && (!m_advect_tracer || m_ntrac == 0)) { continue; }
+
+        int const ncomp = tracer ? m_ntrac : AMREX_SPACEDIM;
+        auto hist0 = get_scratch(hist_name(tracer,0), IndexType::TheCellType(), ncomp, 0);
+        if (nkeep > 1) {
+            auto hist1 = get_scratch(hist_name(tracer,1), IndexType::TheCellType(), ncomp, 0);
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                std::swap(*hist0[lev], *hist1[lev]);
+            }
+        }
+
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            auto const& ld = *m_leveldata[lev];
+            MultiFab::Copy(*hist0[lev], tracer ? ld.tracer_o : ld.velocity_o, 0, 0, ncomp, 0);
+        }
+    }
+
+    m_diffusion_guess.time[1] = m_diffusion_guess.time[0];
+    m_diffusion_guess.time[0] = m_t_old[0];
+    m_diffusion_guess.nhist = std::min(m_diffusion_guess.nhist + 1, nkeep);
+}
@@ -0,0 +1,249 @@
+#include <incflo.H>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+using namespace amrex;
+
+//
+// Super time stepping of the diffusion terms with the second order
+// Runge-Kutta-Legendre scheme (RKL2) of Meyer, Balsara & Aslam (JCP 2014).
+//
+// With diffusion_type = 3 the explicit update leaves out the diffusion terms,
+// as for the implicit scheme, and the provisional state is then advanced by
+//
+//     du/dt = L(u)
+//
+// over dt, with L(u) = div(tau)/rho for the velocity and div(mu grad s)/rho
+// (or div(mu grad s) for non-conservative tracers) for the tracers. This only
+// applies the operators of compute_divtau and compute_laps, s times, where the
+// number of stages s is chosen from the ratio of dt to the time step dt_diff
+// that forward Euler would be stable with,
+//
+//     dt <= dt_diff * (s*s + s - 2) / 4
+//
+// Since dt is set by the advective CFL, s grows only with the square root of
+// dt/dt_diff, and no linear system has to be solved.
+//
+
+int
+incflo::rkl2_stages (Real dt, Real rate)
+{
+    // rate = 1/dt_diff
+    Real const r = dt * rate;
+    int const s = static_cast<int>(std::ceil(Real(0.5) * (std::sqrt(Real(9.0) + Real(16.0)*r) - Real(1.0))));
+    return std::max(s, 2);
+}
+
+//
+// 1/dt_diff, from the estimate 2 * max(eta/rho) * sum(1/dx^2) of the largest
+// eigenvalue of L. With iconserv, the components that are not conservative
+// are not divided by rho. factor accounts for the grad(u)^T term of the
+// tensor operator, which at most doubles it.
+//
+Real
+incflo::rkl2_rate (Vector<MultiFab const*> const& density,
+                   Vector<MultiFab const*> const& eta,
+                   int const* iconserv, Real factor) const
+{
+    int const ncomp = eta[0]->nComp();
+
+    Real rate = Real(0.0);
+    for (int lev = 0; lev <= finest_level; ++lev)
+    {
+        auto const dxinv = geom[lev].InvCellSizeArray();
+        Real const dxinv_norm = AMREX_D_TERM(dxinv[0]*dxinv[0], + dxinv[1]*dxinv[1], + dxinv[2]*dxinv[2]);
+
+        auto const& rho = density[lev]->const_arrays();
+        auto const& mu  = eta[lev]->const_arrays();
+
+        ReduceOps<ReduceOpMax> reduce_op;
+        ReduceData<Real> reduce_data(reduce_op);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
+
+        reduce_op.eval(*eta[lev], IntVect(0), reduce_data,
+        [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept -> ReduceTuple
+        {
+            Real const rhoinv = Real(1.0)/rho[box_no](i,j,k);
+            Real nu = Real(0.0);
+            for (int n = 0; n < ncomp; ++n) {
+                Real const scale = (iconserv == nullptr || iconserv[n]) ? rhoinv : Real(1.0);
+                nu = amrex::max(nu, mu[box_no](i,j,k,n) * scale);
+            }
+            return { nu };
+        });
+
+        Real const nu_max = amrex::get<0>(reduce_data.value(reduce_op));
+        rate = std::max(rate, factor * Real(2.0) * nu_max * dxinv_norm);
+    }
+    ParallelAllReduce::Max(rate, ParallelContext::CommunicatorSub());
+    return rate;
+}
+
+//
+// Advance state by dt with s RKL2 stages of
+//
+//     Y_j = mu_j Y_{j-1} + nu_j Y_{j-2} + (1 - mu_j - nu_j) Y_0
+//         + mut_j dt L(Y_{j-1}) + gamt_j dt L(Y_0)
+//
+// where apply(LY, Y) returns LY = L(Y) and fill(lev, Y) fills the physical
+// boundary ghost cells of Y. The stages are kept in the scratch pool.
+//
+template <typename A, typename F>
+void
+incflo::rkl2_advance (std::string const& name, Vector<MultiFab*> const& state, int ncomp,
+                      Real dt, int s, A const& apply, F const& fill)
+{
+    auto y0  = get_scratch(name+"_y0" , IndexType::TheCellType(), ncomp, 1);
+    auto y1  = get_scratch(name+"_y1" , IndexType::TheCellType(), ncomp, 1);
+    auto y2  = get_scratch(name+"_y2" , IndexType::TheCellType(), ncomp, 1);
+    auto ly0 = get_scratch(name+"_ly0", IndexType::TheCellType(), ncomp, 0);
+    auto ly  = get_scratch(name+"_ly" , IndexType::TheCellType(), ncomp, 0);
+
+    auto average_down_stage = [&] (Vector<MultiFab*> const& y)
+    {
+        for (int lev = finest_level-1; lev >= 0; --lev) {
+#ifdef AMREX_USE_EB
+            amrex::EB_average_down(*y[lev+1], *y[lev], 0, ncomp, refRatio(lev));
+#else
+            amrex::average_down(*y[lev+1], *y[lev], 0, ncomp, refRatio(lev));
+#endif
+        }
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            fill(lev, *y[lev]);
+        }
+    };
+
+    // b_j of the scheme, with b_0 = b_1 = b_2 = 1/3
+    auto b = [] (int j) -> Real {
+        return (j < 2) ? Real(1.0)/Real(3.0)
+                       : Real(j*j + j - 2) / Real(2*j*(j+1));
+    };
+    Real const w1 = Real(4.0) / Real(s*s + s - 2);
+
+    // Y_0 and the first stage Y_1 = Y_0 + mut_1 dt L(Y_0)
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        MultiFab::Copy(*y0[lev], *state[lev], 0, 0, ncomp, 1);
+    }
+    apply(ly0, GetVecOfConstPtrs(y0));
+
+    Real const mut1 = b(1) * w1;
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        MultiFab::LinComb(*y1[lev], Real(1.0), *y0[lev], 0, mut1*dt, *ly0[lev], 0, 0, ncomp, 0);
+    }
+    average_down_stage(y1);
+
+    // y1 holds Y_{j-1} and y2 Y_{j-2}; Y_j overwrites y2 and the two are swapped
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        MultiFab::Copy(*y2[lev], *y0[lev], 0, 0, ncomp, 1);
+    }
+    for (int stage = 2; stage <= s; ++stage)
+    {
+        Real const mu   = Real(2*stage-1)/Real(stage) * b(stage)/b(stage-1);
+        Real const nu   = -Real(stage-1)/Real(stage) * b(stage)/b(stage-2);
+        Real const mut  = mu * w1;
+        Real const gamt = -(Real(1.0) - b(stage-1)) * mut;
+
+        apply(ly, GetVecOfConstPtrs(y1));
+
+        Real const c0 = Real(1.0) - mu - nu;
+        for (int lev = 0; lev <= finest_level; ++lev)
+        {
+            auto const& yj   = y2[lev]->arrays();
+            auto const& yjm1 = y1[lev]->const_arrays();
+            auto const& yz   = y0[lev]->const_arrays();
+            auto const& lyj  = ly[lev]->const_arrays();
+            auto const& lyz  = ly0[lev]->const_arrays();
+            ParallelFor(*ly[lev], IntVect(0), ncomp,
+            [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k, int n) noexcept
+            {
+                // yj holds Y_{j-2} on entry
+                yj[box_no](i,j,k,n) = mu * yjm1[box_no](i,j,k,n) + nu * yj[box_no](i,j,k,n)
+                    + c0 * yz[box_no](i,j,k,n)
+                    + dt * (mut * lyj[box_no](i,j,k,n) + gamt * lyz[box_no](i,j,k,n));
+            });
+        }
+        Gpu::streamSynchronize();
+
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            std::swap(*y1[lev], *y2[lev]);
+        }
+        average_down_stage(y1);
+    }
+
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        MultiFab::Copy(*state[lev], *y1[lev], 0, 0, ncomp, 0);
+    }
+}
+
+void
+incflo::diffuse_velocity_rkl2 (Vector<MultiFab      *> const& vel,
+                               Vector<MultiFab      *> const& density,
+                               Vector<MultiFab const*> const& eta,
+                               Real dt_diff)
+{
+    BL_PROFILE("incflo::diffuse_velocity_rkl2()");
+
+    auto const rho = GetVecOfConstPtrs(density);
+    Real const rate = rkl2_rate(rho, eta, nullptr, use_tensor_solve ? Real(2.0) : Real(1.0));
+    if (rate <= Real(0.0)) { return; }
+
+    int const s = rkl2_stages(dt_diff, rate);
+    if (m_verbose > 0) {
+        amrex::Print() << "RKL2 velocity diffusion: " << s << " stages for dt/dt_diff = "
+                       << dt_diff*rate << std::endl;
+    }
+
+    Real const time = m_cur_time + m_dt;
+    rkl2_advance("vel_rkl2", vel, AMREX_SPACEDIM, dt_diff, s,
+                 [&] (Vector<MultiFab*> const& ly, Vector<MultiFab const*> const& y)
+                 {
+                     // compute_divtau only divides by rho if !m_advect_momentum
+                     compute_divtau(ly, y, rho, eta);
+                     if (m_advect_momentum) {
+                         for (int lev = 0; lev <= finest_level; ++lev) {
+                             for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                                 MultiFab::Divide(*ly[lev], *rho[lev], 0, n, 1, 0);
+                             }
+                         }
+                     }
+                 },
+                 [&] (int lev, MultiFab& y) { fillphysbc_velocity(lev, time, y, 1); });
+}
+
+void
+incflo::diffuse_scalar_rkl2 (Vector<MultiFab      *> const& scalar,
+                             Vector<MultiFab      *> const& density,
+                             Vector<MultiFab const*> const& eta,
+                             Real dt_diff)
+{
+    BL_PROFILE("incflo::diffuse_scalar_rkl2()");
+
+    auto const rho = GetVecOfConstPtrs(density);
+    Real const rate = rkl2_rate(rho, eta, get_tracer_iconserv_device_ptr(), Real(1.0));
+    if (rate <= Real(0.0)) { return; }
+
+    int const s = rkl2_stages(dt_diff, rate);
+    if (m_verbose > 0) {
+        amrex::Print() << "RKL2 tracer diffusion: " << s << " stages for dt/dt_diff = "
+                       << dt_diff*rate << std::endl;
+    }
+
+    Real const time = m_cur_time + m_dt;
+    rkl2_advance("tra_rkl2", scalar, m_ntrac, dt_diff, s,
+                 [&] (Vector<MultiFab*> const& ly, Vector<MultiFab const*> const& y)
+                 {
+                     // As in the explicit update, only conservative tracers
+                     // are divided by rho
+                     compute_laps(ly, y, eta);
+                     for (int lev = 0; lev <= finest_level; ++lev) {
+                         for (int n = 0; n < m_ntrac; ++n) {
+                             if (m_iconserv_tracer[n]) {
+                                 MultiFab::Divide(*ly[lev], *rho[lev], 0, n, 1, 0);
+                             }
+                         }
+                     }
+                 },
+                 [&] (int lev, MultiFab& y) { fillphysbc_tracer(lev, time, y, 1); });
+}
@@ -3,6 +3,7 @@
 // Need this for TagCutCells
 #ifdef AMREX_USE_EB
 #include <AMReX_EBAmrUtil.H>
+#include <AMReX_EB2.H>
 #include <utility>
 #endif
 
@@ -11,6 +12,11 @@
 using namespace amrex;
 
 incflo::incflo ()
+    : incflo(ParallelDescriptor::second())
+{}
+
+incflo::incflo (double wall_start)
+    : m_wall_start(wall_start)
 {
     // NOTE: Geometry on all levels has just been defined in the AmrCore
     // constructor. No valid BoxArray and DistributionMapping have been defined.
@@ -20,8 +26,11 @@ incflo::incflo ()
     ReadParameters();
 
 #ifdef AMREX_USE_EB
-    // This is needed before initializing level MultiFab
-    MakeEBGeometry();
+    // This is needed before initializing level MultiFab. In an ensemble all
+    // members share the geometry, so only the first one builds it.
+    if (EB2::TopIndexSpaceIfPresent() == nullptr) {
+        MakeEBGeometry();
+    }
 #endif
 
     // Initialize memory for data-array internals
@@ -137,7 +146,7 @@ void incflo::InitData ()
 #endif
 #endif
 
-    if (m_verbose > 0 && ParallelDescriptor::IOProcessor()) {
+    if (m_verbose > 0 && ParallelContext::IOProcessorSub()) {
         printGridSummary(amrex::OutStream(), 0, finest_level);
     }
 }
@@ -150,6 +159,10 @@ void incflo::Evolve()
                            ((m_stop_time <= 0.) && (m_max_step <= 0)) || (m_max_step >= 0 && m_nstep >= m_max_step) )
                          && !m_steady_state;
 
+    m_wall_last_step = ParallelDescriptor::second();
+
+    bool stop_requested = false;
+
     while(!do_not_evolve)
     {
         if (m_verbose > 0)
@@ -161,7 +174,7 @@ void incflo::Evolve()
         {
             if (m_verbose > 0) amrex::Print() << "Regridding...\n";
             regrid(0, m_cur_time);
-            if (m_verbose > 0 && ParallelDescriptor::IOProcessor()) {
+            if (m_verbose > 0 && ParallelContext::IOProcessorSub()) {
                 printGridSummary(amrex::OutStream(), 0, finest_level);
             }
         }
@@ -171,21 +184,35 @@ void incflo::Evolve()
         m_nstep++;
         m_cur_time += m_dt;
 
-        if (writeNow())
         {
-            WritePlotFile();
-            m_last_plt = m_nstep;
-        }
-        if (writeNow(m_smallplot_int, m_smallplot_per_approx, -1.))
-        {
-            WriteSmallPlotFile();
-            m_last_smallplt = m_nstep;
+            Telemetry::Timer io_timer(m_telemetry, Telemetry::Phase::IO);
+
+            if (writeNow())
+            {
+                WritePlotFile();
+                m_last_plt = m_nstep;
+            }
+            if (writeNow(m_smallplot_int, m_smallplot_per_approx, -1.))
+            {
+                WriteSmallPlotFile();
+                m_last_smallplt = m_nstep;
+            }
+
+            if(m_check_int > 0 && (m_nstep % m_check_int == 0))
+            {
+                WriteCheckPointFile();
+                m_last_chk = m_nstep;
+            }
         }
 
-        if(m_check_int > 0 && (m_nstep % m_check_int == 0))
+        if (m_telemetry.enabled())
         {
-            WriteCheckPointFile();
-            m_last_chk = m_nstep;
+            // One reduction for all the timers of this step
+            double step_time = m_telemetry.end_step(m_nstep, m_cur_time);
+            if (m_verbose > 0)
+            {
+                amrex::Print() << "Time per step " << step_time << std::endl;
+            }
         }
 
         if(m_KE_int > 0 && (m_nstep % m_KE_int == 0))
@@ -193,8 +220,19 @@ void incflo::Evolve()
             amrex::Print() << "Time, Kinetic Energy: " << m_cur_time << ", " << ComputeKineticEnergy() << std::endl;
         }
 
+        // Checkpoint if a signal asked for it or if there is not enough
+        // walltime left for another step
+        if (CheckpointRequested(stop_requested) && m_nstep != m_last_chk)
+        {
+            WriteCheckPointFile();
+            m_last_chk = m_nstep;
+            // The job may be killed soon after, so make sure it is on disk
+            m_async_output.flush();
+        }
+
         // Mechanism to terminate incflo normally.
-        do_not_evolve = (m_steady_state && SteadyStateReached()) ||
+        do_not_evolve = stop_requested ||
+                        (m_steady_state && SteadyStateReached()) ||
                         ((m_stop_time > 0. && (m_cur_time >= m_stop_time - 1.e-12 * m_dt)) ||
                          (m_max_step >= 0 && m_nstep >= m_max_step));
     }
@@ -204,10 +242,13 @@ void incflo::Evolve()
         WriteCheckPointFile();
     }
     if( (m_plot_int > 0 || m_plot_per_exact > 0 || m_plot_per_approx > 0)
-        && m_nstep != m_last_plt)
+        && m_nstep != m_last_plt && !stop_requested)
     {
         WritePlotFile();
     }
+
+    // Make sure everything is on disk before we return
+    m_async_output.flush();
 }
 
 void
@@ -273,6 +314,11 @@ void incflo::MakeNewLevelFromScratch (int lev, Real time, const BoxArray& new_gr
 
     m_leveldata[lev] = std::make_unique<LevelData>(grids[lev], dmap[lev], *m_factory[lev],
                                                    this);
+    m_scratch.clear(lev);
+    m_bc_mask_cache.clear(lev);
+    m_nodal_projector.reset();
+    reset_mixed_precision_mac();
+    reset_strainrate_cache();
 
     m_t_new[lev] = time;
     m_t_old[lev] = time - Real(1.e200);
@@ -8,6 +8,7 @@ void incflo::Advance()
 
     // Start timing current time step
     Real strt_step = static_cast<Real>(ParallelDescriptor::second());
+    m_telemetry.begin_step();
 
     // Compute time step size
     int initialisation = ( m_dt < 0 );
@@ -29,9 +30,9 @@ void incflo::Advance()
                        << " with dt = " << m_dt << ".\n" << std::endl;
     }
 
-    copy_from_new_to_old_velocity();
-    copy_from_new_to_old_density();
-    copy_from_new_to_old_tracer();
+    // The predictor builds the new state entirely from the old one, so we can
+    // swap storage here instead of copying new into old
+    swap_new_and_old_state();
 
     int ng = nghost_state();
     for (int lev = 0; lev <= finest_level; ++lev) {
@@ -40,6 +41,7 @@ void incflo::Advance()
         if (m_advect_tracer) {
             fillpatch_tracer(lev, m_t_old[lev], m_leveldata[lev]->tracer_o, ng);
         }
+        m_leveldata[lev]->ng_valid_old = ng;
     }
 
 #ifdef AMREX_USE_EB
@@ -70,6 +72,9 @@ void incflo::Advance()
     particleData.Redistribute();
 #endif
 
+    // Keep u^n for the initial guess of the diffusion solves of the next steps
+    save_diffusion_history();
+
 #if 0
     // This sums over all levels
     if (m_test_tracer_conservation) {
@@ -81,10 +86,27 @@ void incflo::Advance()
 
     // Stop timing current time step
     Real end_step = static_cast<Real>(ParallelDescriptor::second()) - strt_step;
-    ParallelDescriptor::ReduceRealMax(end_step, ParallelDescriptor::IOProcessorNumber());
-    if (m_verbose > 0)
+
+    if (m_telemetry.enabled())
     {
-        amrex::Print() << "Time per step " << end_step << std::endl;
+        // The step time is reduced together with the rest of the telemetry
+        // once the output of this step has been written (see Evolve)
+        m_telemetry.set_step_time(end_step);
+
+        Vector<Long> cells(finest_level+1);
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            cells[lev] = grids[lev].numPts();
+        }
+        m_telemetry.set_cells(cells);
+    }
+    else
+    {
+        ParallelReduce::Max<Real>(end_step, ParallelContext::IOProcessorNumberSub(),
+                                  ParallelContext::CommunicatorSub());
+        if (m_verbose > 0)
+        {
+            amrex::Print() << "Time per step " << end_step << std::endl;
+        }
     }
 }
 
@@ -68,6 +68,7 @@ using namespace amrex;
 void incflo::ApplyCorrector()
 {
     BL_PROFILE("incflo::ApplyCorrector");
+    Telemetry::Timer timer(m_telemetry, Telemetry::Phase::Corrector);
 
     // We use the new time value for things computed on the "*" state
     Real new_time = m_cur_time + m_dt;
@@ -75,20 +76,17 @@ void incflo::ApplyCorrector()
     // *************************************************************************************
     // Allocate space for the MAC velocities
     // *************************************************************************************
-    Vector<MultiFab> AMREX_D_DECL(u_mac(finest_level+1), v_mac(finest_level+1), w_mac(finest_level+1));
+    // These live in m_scratch and are only re-allocated when the grids change
     int ngmac = nghost_mac();
+    AMREX_D_TERM(auto u_mac = get_scratch("u_mac", IndexType(IntVect::TheDimensionVector(0)), 1, ngmac);,
+                 auto v_mac = get_scratch("v_mac", IndexType(IntVect::TheDimensionVector(1)), 1, ngmac);,
+                 auto w_mac = get_scratch("w_mac", IndexType(IntVect::TheDimensionVector(2)), 1, ngmac););
 
     for (int lev = 0; lev <= finest_level; ++lev) {
-        AMREX_D_TERM(u_mac[lev].define(amrex::convert(grids[lev],IntVect::TheDimensionVector(0)), dmap[lev],
-                          1, ngmac, MFInfo(), Factory(lev));,
-                     v_mac[lev].define(amrex::convert(grids[lev],IntVect::TheDimensionVector(1)), dmap[lev],
-                          1, ngmac, MFInfo(), Factory(lev));,
-                     w_mac[lev].define(amrex::convert(grids[lev],IntVect::TheDimensionVector(2)), dmap[lev],
-                          1, ngmac, MFInfo(), Factory(lev)););
         if (ngmac > 0) {
-            AMREX_D_TERM(u_mac[lev].setBndry(0.0);,
-                         v_mac[lev].setBndry(0.0);,
-                         w_mac[lev].setBndry(0.0););
+            AMREX_D_TERM(u_mac[lev]->setBndry(0.0);,
+                         v_mac[lev]->setBndry(0.0);,
+                         w_mac[lev]->setBndry(0.0););
         }
     }
 
@@ -96,44 +94,36 @@ void incflo::ApplyCorrector()
     // We only reach the corrector if advection_type == MOL which means we don't use the forces
     //    in constructing the advection term
     // **********************************************************************************************
-    Vector<MultiFab> vel_forces, tra_forces;
-    Vector<MultiFab> vel_eta, tra_eta;
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        vel_forces.emplace_back(grids[lev], dmap[lev], AMREX_SPACEDIM, nghost_force(),
-                                MFInfo(), Factory(lev));
-        if (m_advect_tracer) {
-            tra_forces.emplace_back(grids[lev], dmap[lev], m_ntrac, nghost_force(),
-                                    MFInfo(), Factory(lev));
-        }
-        vel_eta.emplace_back(grids[lev], dmap[lev], 1, 1, MFInfo(), Factory(lev));
-        if (m_advect_tracer) {
-            tra_eta.emplace_back(grids[lev], dmap[lev], m_ntrac, 1, MFInfo(), Factory(lev));
-        }
+    auto vel_forces = get_scratch("vel_forces", IndexType::TheCellType(), AMREX_SPACEDIM, nghost_force());
+    auto vel_eta    = get_scratch("vel_eta"   , IndexType::TheCellType(), 1, 1);
+
+    Vector<MultiFab*> tra_forces, tra_eta;
+    if (m_advect_tracer) {
+        tra_forces = get_scratch("tra_forces", IndexType::TheCellType(), m_ntrac, nghost_force());
+        tra_eta    = get_scratch("tra_eta"   , IndexType::TheCellType(), m_ntrac, 1);
     }
 
     // *************************************************************************************
     // Compute the MAC-projected velocities at all levels
     // *************************************************************************************
     bool include_pressure_gradient = !(m_use_mac_phi_in_godunov);
-    compute_vel_forces(GetVecOfPtrs(vel_forces), get_velocity_new_const(),
+    compute_vel_forces(vel_forces, get_velocity_new_const(),
                        get_density_new_const(), get_tracer_new_const(), get_tracer_new_const(),
                        include_pressure_gradient);
     compute_MAC_projected_velocities(get_velocity_new_const(), get_density_new_const(),
-                                     AMREX_D_DECL(GetVecOfPtrs(u_mac), GetVecOfPtrs(v_mac),
-                                     GetVecOfPtrs(w_mac)), GetVecOfPtrs(vel_forces), new_time);
+                                     AMREX_D_DECL(u_mac, v_mac, w_mac), vel_forces, new_time);
     // *************************************************************************************
     // Compute the explicit "new" advective terms R_u^(n+1,*), R_r^(n+1,*) and R_t^(n+1,*)
     // *************************************************************************************
     compute_convective_term(get_conv_velocity_new(), get_conv_density_new(), get_conv_tracer_new(),
                             get_velocity_new_const(), get_density_new_const(), get_tracer_new_const(),
-                            AMREX_D_DECL(GetVecOfPtrs(u_mac), GetVecOfPtrs(v_mac),
-                            GetVecOfPtrs(w_mac)),
+                            AMREX_D_DECL(u_mac, v_mac, w_mac),
                             {}, {}, new_time);
 
     // *************************************************************************************
     // Compute viscosity / diffusive coefficients
     // *************************************************************************************
-    compute_viscosity(GetVecOfPtrs(vel_eta), get_density_new(), get_velocity_new(), new_time, 1);
+    compute_viscosity(vel_eta, get_density_new(), get_velocity_new(), new_time, 1);
 
     // Here we create divtau of the (n+1,*) state that was computed in the predictor
     if ( (m_diff_type == DiffusionType::Explicit) || use_tensor_correction )
@@ -162,8 +152,7 @@ void incflo::ApplyCorrector()
     // **********************************************************************************************
     bool incremental_projection = false;
     ApplyProjection(get_density_nph_const(),
-                    AMREX_D_DECL(GetVecOfPtrs(u_mac), GetVecOfPtrs(v_mac),
-                    GetVecOfPtrs(w_mac)),new_time,m_dt,incremental_projection);
+                    AMREX_D_DECL(u_mac, v_mac, w_mac),new_time,m_dt,incremental_projection);
 
 #ifdef AMREX_USE_EB
     // **********************************************************************************************
@@ -183,4 +172,6 @@ void incflo::ApplyCorrector()
     evolveTracerParticles(AMREX_D_DECL(GetVecOfConstPtrs(u_mac), GetVecOfConstPtrs(v_mac),
                                        GetVecOfConstPtrs(w_mac)));
 #endif
+
+    new_velocity_changed();
 }
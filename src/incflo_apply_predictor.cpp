@@ -63,66 +63,57 @@ using namespace amrex;
 //
 //     vel = u** - dt * grad p / rho^nph
 //
-// It is assumed that the ghost cells of the old data have been filled and
-// the old and new data are the same in valid region.
+// It is assumed that the ghost cells of the old data have been filled. The new
+// data is computed entirely from the old data, so its contents on entry are
+// irrelevant (except for density / tracers that are not evolved, which must be
+// the same as the old data).
 //
 void incflo::ApplyPredictor (bool incremental_projection)
 {
     BL_PROFILE("incflo::ApplyPredictor");
+    Telemetry::Timer timer(m_telemetry, Telemetry::Phase::Predictor);
 
     // We use the new time value for things computed on the "*" state
     Real new_time = m_cur_time + m_dt;
 
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        AMREX_ASSERT(m_leveldata[lev]->ng_valid_old >= nghost_state());
+    }
+
     // *************************************************************************************
     // Allocate space for the MAC velocities
     // *************************************************************************************
-    Vector<MultiFab> u_mac(finest_level+1), v_mac(finest_level+1), w_mac(finest_level+1);
+    // These live in m_scratch and are only re-allocated when the grids change
     int ngmac = nghost_mac();
+    AMREX_D_TERM(auto u_mac = get_scratch("u_mac", IndexType(IntVect::TheDimensionVector(0)), 1, ngmac);,
+                 auto v_mac = get_scratch("v_mac", IndexType(IntVect::TheDimensionVector(1)), 1, ngmac);,
+                 auto w_mac = get_scratch("w_mac", IndexType(IntVect::TheDimensionVector(2)), 1, ngmac););
 
     for (int lev = 0; lev <= finest_level; ++lev) {
-        AMREX_D_TERM(u_mac[lev].define(amrex::convert(grids[lev],IntVect::TheDimensionVector(0)), dmap[lev],
-                          1, ngmac, MFInfo(), Factory(lev));,
-                     v_mac[lev].define(amrex::convert(grids[lev],IntVect::TheDimensionVector(1)), dmap[lev],
-                          1, ngmac, MFInfo(), Factory(lev));,
-                     w_mac[lev].define(amrex::convert(grids[lev],IntVect::TheDimensionVector(2)), dmap[lev],
-                          1, ngmac, MFInfo(), Factory(lev)););
         // do we still want to do this now that we always call a FillPatch (and all ghost cells get filled)?
         if (ngmac > 0) {
-            AMREX_D_TERM(u_mac[lev].setBndry(0.0);,
-                         v_mac[lev].setBndry(0.0);,
-                         w_mac[lev].setBndry(0.0););
+            AMREX_D_TERM(u_mac[lev]->setBndry(0.0);,
+                         v_mac[lev]->setBndry(0.0);,
+                         w_mac[lev]->setBndry(0.0););
         }
     }
 
-    // *************************************************************************************
-    // Allocate space for half-time density
-    // *************************************************************************************
-    // Forcing terms
-    Vector<MultiFab> vel_forces, tra_forces;
-
-    Vector<MultiFab> vel_eta, tra_eta;
-
     // *************************************************************************************
     // Allocate space for the forcing terms
     // *************************************************************************************
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        vel_forces.emplace_back(grids[lev], dmap[lev], AMREX_SPACEDIM, nghost_force(),
-                                MFInfo(), Factory(lev));
+    auto vel_forces = get_scratch("vel_forces", IndexType::TheCellType(), AMREX_SPACEDIM, nghost_force());
+    auto vel_eta    = get_scratch("vel_eta"   , IndexType::TheCellType(), 1, 1);
 
-        if (m_advect_tracer) {
-            tra_forces.emplace_back(grids[lev], dmap[lev], m_ntrac, nghost_force(),
-                                    MFInfo(), Factory(lev));
-        }
-        vel_eta.emplace_back(grids[lev], dmap[lev], 1, 1, MFInfo(), Factory(lev));
-        if (m_advect_tracer) {
-            tra_eta.emplace_back(grids[lev], dmap[lev], m_ntrac, 1, MFInfo(), Factory(lev));
-        }
+    Vector<MultiFab*> tra_forces, tra_eta;
+    if (m_advect_tracer) {
+        tra_forces = get_scratch("tra_forces", IndexType::TheCellType(), m_ntrac, nghost_force());
+        tra_eta    = get_scratch("tra_eta"   , IndexType::TheCellType(), m_ntrac, 1);
     }
 
     // *************************************************************************************
     // Compute viscosity / diffusive coefficients
     // *************************************************************************************
-    compute_viscosity(GetVecOfPtrs(vel_eta),
+    compute_viscosity(vel_eta,
                       get_density_old(), get_velocity_old(),
                       m_cur_time, 1);
 
@@ -141,7 +132,7 @@ void incflo::ApplyPredictor (bool incremental_projection)
     // *************************************************************************************
     if (m_advect_tracer)
     {
-        compute_tracer_diff_coeff(GetVecOfPtrs(tra_eta),1);
+        compute_tracer_diff_coeff(tra_eta,1);
         if (need_divtau()) {
             compute_laps(get_laps_old(), get_tracer_old_const(), GetVecOfConstPtrs(tra_eta));
         }
@@ -151,7 +142,7 @@ void incflo::ApplyPredictor (bool incremental_projection)
     // Compute the forcing terms
     // *************************************************************************************
     bool include_pressure_gradient = !(m_use_mac_phi_in_godunov);
-    compute_vel_forces(GetVecOfPtrs(vel_forces), get_velocity_old_const(),
+    compute_vel_forces(vel_forces, get_velocity_old_const(),
                        get_density_old_const(), get_tracer_old_const(), get_tracer_old_const(),
                        include_pressure_gradient);
 
@@ -159,8 +150,7 @@ void incflo::ApplyPredictor (bool incremental_projection)
     // Compute the MAC-projected velocities at all levels
     // *************************************************************************************
     compute_MAC_projected_velocities(get_velocity_old_const(), get_density_old_const(),
-                                     AMREX_D_DECL(GetVecOfPtrs(u_mac), GetVecOfPtrs(v_mac),
-                                     GetVecOfPtrs(w_mac)), GetVecOfPtrs(vel_forces), m_cur_time);
+                                     AMREX_D_DECL(u_mac, v_mac, w_mac), vel_forces, m_cur_time);
 
     // *************************************************************************************
     // if (advection_type == "Godunov")
@@ -171,9 +161,8 @@ void incflo::ApplyPredictor (bool incremental_projection)
     // *************************************************************************************
     compute_convective_term(get_conv_velocity_old(), get_conv_density_old(), get_conv_tracer_old(),
                             get_velocity_old_const(), get_density_old_const(), get_tracer_old_const(),
-                            AMREX_D_DECL(GetVecOfPtrs(u_mac), GetVecOfPtrs(v_mac),
-                            GetVecOfPtrs(w_mac)),
-                            GetVecOfPtrs(vel_forces), GetVecOfPtrs(tra_forces),
+                            AMREX_D_DECL(u_mac, v_mac, w_mac),
+                            vel_forces, tra_forces,
                             m_cur_time);
 
     // *************************************************************************************
@@ -195,8 +184,7 @@ void incflo::ApplyPredictor (bool incremental_projection)
     // Project velocity field, update pressure
     // **********************************************************************************************
     ApplyProjection(get_density_nph_const(),
-                    AMREX_D_DECL(GetVecOfPtrs(u_mac), GetVecOfPtrs(v_mac),
-                    GetVecOfPtrs(w_mac)),new_time,m_dt,incremental_projection);
+                    AMREX_D_DECL(u_mac, v_mac, w_mac),new_time,m_dt,incremental_projection);
 
 #ifdef INCFLO_USE_PARTICLES
     // **************************************************************************************
@@ -217,4 +205,6 @@ void incflo::ApplyPredictor (bool incremental_projection)
                                    AMREX_D_DECL(GetVecOfConstPtrs(u_mac), GetVecOfConstPtrs(v_mac),
                                    GetVecOfConstPtrs(w_mac)));
 #endif
+
+    new_velocity_changed();
 }
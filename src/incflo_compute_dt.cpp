@@ -34,141 +34,100 @@ void incflo::ComputeDt (int initialization, bool explicit_diffusion)
     Real diff_cfl = Real(0.0);
     Real forc_cfl = Real(0.0);
 
+    GpuArray<Real,3> l_gravity{m_gravity[0],m_gravity[1],m_gravity[2]};
+    GpuArray<Real,3> l_gp0{m_gp0[0], m_gp0[1], m_gp0[2]};
+    const bool use_boussinesq = m_use_boussinesq;
+    const bool probtype_16 = (m_probtype == 16);
+    const Real Re = (probtype_16) ? Real(1.0)/m_mu : Real(0.0);
+
     for (int lev = 0; lev <= finest_level; ++lev)
     {
+        auto const dx    = geom[lev].CellSizeArray();
         auto const dxinv = geom[lev].InvCellSizeArray();
-        MultiFab const& vel   = m_leveldata[lev]->velocity;
-        MultiFab const& rho   = m_leveldata[lev]->density;
-        MultiFab const& tra   = m_leveldata[lev]->tracer;
-        MultiFab const& tra_o = m_leveldata[lev]->tracer_o;
+        MultiFab const& vel_mf = m_leveldata[lev]->velocity;
 
-        Real conv_lev = Real(0.0);
-        Real diff_lev = Real(0.0);
-        Real forc_lev = Real(0.0);
+        auto const& vel   = vel_mf.const_arrays();
+        auto const& rho   = m_leveldata[lev]->density.const_arrays();
+        auto const& gradp = m_leveldata[lev]->gp.const_arrays();
+        auto const& tra   = m_leveldata[lev]->tracer.const_arrays();
+        // The old tracer is not set yet at initialisation (or after a restart)
+        auto const& tra_o = (initialization) ? m_leveldata[lev]->tracer.const_arrays()
+                                             : m_leveldata[lev]->tracer_o.const_arrays();
 
-       // Make a temporary here to hold vel_forces
-       MultiFab vel_forces(grids[lev], dmap[lev], AMREX_SPACEDIM, 0);
+#ifdef AMREX_USE_EB
+        const bool skip_covered = !vel_mf.isAllRegular();
+        MultiArray4<EBCellFlag const> flag;
+        if (skip_covered) {
+            flag = EBFactory(lev).getMultiEBCellFlagFab().const_arrays();
+        }
+#endif
 
-       compute_vel_forces_on_level (lev, vel_forces, vel, rho, tra_o, tra);
+        // Convection, 1/rho and forcing are all evaluated in the same pass.
+        // The forcing is the one computed by compute_vel_forces_on_level with
+        // include_pressure_gradient = true, but built in registers rather than
+        // stored in a temporary MultiFab.
+        ReduceOps<ReduceOpMax, ReduceOpMax, ReduceOpMax> reduce_op;
+        ReduceData<Real, Real, Real> reduce_data(reduce_op);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
 
+        reduce_op.eval(vel_mf, IntVect(0), reduce_data,
+        [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept -> ReduceTuple
+        {
 #ifdef AMREX_USE_EB
-        if (!vel.isAllRegular()) {
-            auto const& flag = EBFactory(lev).getMultiEBCellFlagFab();
-            conv_lev = amrex::ReduceMax(vel, flag, 0,
-                       [=] AMREX_GPU_HOST_DEVICE (Box const& b,
-                                                  Array4<Real const> const& v,
-                                                  Array4<EBCellFlag const> const& f) -> Real
-                       {
-                           Real mx = -1.0;
-                           amrex::Loop(b, [=,&mx] (int i, int j, int k) noexcept
-                           {
-                               if (!f(i,j,k).isCovered()) {
-                                   mx = amrex::max(AMREX_D_DECL(amrex::Math::abs(v(i,j,k,0))*dxinv[0],
-                                                                amrex::Math::abs(v(i,j,k,1))*dxinv[1],
-                                                                amrex::Math::abs(v(i,j,k,2))*dxinv[2]), mx);
-                               }
-                           });
-                           return mx;
-                       });
-            if (explicit_diffusion) {
-                diff_lev = amrex::ReduceMax(rho, flag, 0,
-                           [=] AMREX_GPU_HOST_DEVICE (Box const& b,
-                                                      Array4<Real const> const& r,
-                                                      Array4<EBCellFlag const> const& f) -> Real
-                          {
-                              Real mx = Real(-1.0);
-                              amrex::Loop(b, [=,&mx] (int i, int j, int k) noexcept
-                              {
-                                  if (!f(i,j,k).isCovered()) {
-                                      Real rho_inv = Real(1.0)/r(i,j,k);
-                                      mx = amrex::max(rho_inv, mx);
-                                  }
-                              });
-                              return mx;
-                          });
-                diff_lev *= m_mu;
+            if (skip_covered && flag[box_no](i,j,k).isCovered()) {
+                return { Real(0.0), Real(0.0), Real(0.0) };
             }
-
-            // Forcing term -- old way of computing
-            // const auto dxinv_finest = Geom(finest_level).InvCellSizeArray();
-            // forc_lev = std::abs(m_gravity[0] - std::abs(m_gp0[0])) * dxinv_finest[0]
-            //          + std::abs(m_gravity[1] - std::abs(m_gp0[1])) * dxinv_finest[1]
-            //          + std::abs(m_gravity[2] - std::abs(m_gp0[2])) * dxinv_finest[2];
-
-            // Forcing term -- new way of computing using "actual" forcing term
-            forc_lev = amrex::ReduceMax(vel_forces, flag, 0,
-                  [=] AMREX_GPU_HOST_DEVICE (Box const& b,
-                                             Array4<Real const> const& vf,
-                                             Array4<EBCellFlag const> const& f) -> Real
-                  {
-                      Real mx = Real(-1.0);
-                      amrex::Loop(b, [=,&mx] (int i, int j, int k) noexcept
-                      {
-                          if (!f(i,j,k).isCovered()) {
-                              mx = amrex::max(AMREX_D_DECL(amrex::Math::abs(vf(i,j,k,0))*dxinv[0],
-                                                           amrex::Math::abs(vf(i,j,k,1))*dxinv[1],
-                                                           amrex::Math::abs(vf(i,j,k,2))*dxinv[2]), mx);
-                          }
-                      });
-                      return mx;
-                  });
-        } else
 #endif
-        {
-            conv_lev = amrex::ReduceMax(vel, 0,
-                       [=] AMREX_GPU_HOST_DEVICE (Box const& b,
-                                                  Array4<Real const> const& v) -> Real
-                       {
-                           Real mx = Real(-1.0);
-                           amrex::Loop(b, [=,&mx] (int i, int j, int k) noexcept
-                           {
-                               mx = amrex::max(AMREX_D_DECL(amrex::Math::abs(v(i,j,k,0))*dxinv[0],
-                                                            amrex::Math::abs(v(i,j,k,1))*dxinv[1],
-                                                            amrex::Math::abs(v(i,j,k,2))*dxinv[2]), mx);
-                           });
-                           return mx;
-                       });
-
-            if (explicit_diffusion) {
-                diff_lev = amrex::ReduceMax(rho, 0,
-                           [=] AMREX_GPU_HOST_DEVICE (Box const& b,
-                                                      Array4<Real const> const& r) -> Real
-                           {
-                               Real mx = Real(-1.0);
-                               amrex::Loop(b, [=,&mx] (int i, int j, int k) noexcept
-                               {
-                                   Real rho_inv = Real(1.0)/r(i,j,k);
-                                   mx = amrex::max(rho_inv, mx);
-                               });
-                               return mx;
-                           });
-                diff_lev *= m_mu;
+            auto const& v  = vel[box_no];
+            auto const& gp = gradp[box_no];
+
+            Real conv = amrex::max(AMREX_D_DECL(amrex::Math::abs(v(i,j,k,0))*dxinv[0],
+                                                amrex::Math::abs(v(i,j,k,1))*dxinv[1],
+                                                amrex::Math::abs(v(i,j,k,2))*dxinv[2]));
+
+            Real rhoinv = Real(1.0)/rho[box_no](i,j,k);
+
+            GpuArray<Real,AMREX_SPACEDIM> f;
+            if (use_boussinesq) {
+                // Buoyancy depends on the first tracer rather than density
+                Real ft = Real(0.5) * (tra_o[box_no](i,j,k,0) + tra[box_no](i,j,k,0));
+                for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                    f[n] = -gp(i,j,k,n)*rhoinv + l_gravity[n] * ft;
+                }
+            } else {
+                for (int n = 0; n < AMREX_SPACEDIM; ++n) {
+                    f[n] = -(gp(i,j,k,n)+l_gp0[n])*rhoinv + l_gravity[n];
+                }
+                if (probtype_16) {
+                    Real x = (i+0.5) * dx[0];
+                    Real y = (j+0.5) * dx[1];
+
+                    Real g     = y*y*y*y - y*y;
+                    Real ff    = x*x*x*x - 2.*x*x*x + x*x;
+                    Real capF  =  0.2 * x*x*x*x*x   -  0.5 * x*x*x*x   + (1./3.)* x*x*x;
+                    Real capF1 = -4.0 * x*x*x*x*x*x + 12.0 * x*x*x*x*x - 14.    * x*x*x*x + 8.0 * x*x*x - 2.0 * x*x;
+                    Real capF2 = 0.5 * ff * ff;
+                    Real capG1 = -24.0 * y*y*y*y*y + 8.0 * y*y*y - 4.0 * y;
+                    Real fp    = 4.0 * x*x*x - 6.0*x*x + 2.0*x;
+                    Real fppp  = 24.0 * x - 12.0;
+                    Real gpy   =  4.0 * y*y*y - 2.0*y;
+                    Real gpp   = 12.0 * y*y - 2.0;
+
+                    f[1] += 8.0 / Re * (24.0 * capF + 2.0 * fp * gpp + fppp * g) + 64.0 * (capF2 * capG1 - g * gpy * capF1);
+                }
             }
 
-            // Forcing term -- old way of computing
-            // const auto dxinv_finest = Geom(finest_level).InvCellSizeArray();
-            // forc_lev = std::abs(m_gravity[0] - std::abs(m_gp0[0])) * dxinv_finest[0]
-            //          + std::abs(m_gravity[1] - std::abs(m_gp0[1])) * dxinv_finest[1]
-            //          + std::abs(m_gravity[2] - std::abs(m_gp0[2])) * dxinv_finest[2];
-
-            // Forcing term -- new way of computing using "actual" forcing term
-            forc_lev = amrex::ReduceMax(vel_forces, 0,
-                  [=] AMREX_GPU_HOST_DEVICE (Box const& b,
-                                             Array4<Real const> const& vf) -> Real
-                  {
-                      Real mx = Real(-1.0);
-                      amrex::Loop(b, [=,&mx] (int i, int j, int k) noexcept
-                      {
-                          mx = amrex::max(AMREX_D_DECL(amrex::Math::abs(vf(i,j,k,0))*dxinv[0],
-                                                       amrex::Math::abs(vf(i,j,k,1))*dxinv[1],
-                                                       amrex::Math::abs(vf(i,j,k,2))*dxinv[2]), mx);
-                      });
-                      return mx;
-                  });
-        }
+            Real forc = amrex::max(AMREX_D_DECL(amrex::Math::abs(f[0])*dxinv[0],
+                                                amrex::Math::abs(f[1])*dxinv[1],
+                                                amrex::Math::abs(f[2])*dxinv[2]));
 
-        forc_cfl = std::max(forc_cfl, forc_lev);
-        conv_cfl = std::max(conv_cfl, conv_lev);
+            return { conv, rhoinv, forc };
+        });
+
+        auto hv = reduce_data.value(reduce_op);
+        Real conv_lev = amrex::get<0>(hv);
+        Real diff_lev = (explicit_diffusion) ? m_mu * amrex::get<1>(hv) : Real(0.0);
+        Real forc_lev = amrex::get<2>(hv);
 
 #if (AMREX_SPACEDIM == 2)
         Real dxinv_norm = dxinv[0]*dxinv[0]+dxinv[1]*dxinv[1];
@@ -176,23 +135,17 @@ void incflo::ComputeDt (int initialization, bool explicit_diffusion)
         Real dxinv_norm = dxinv[0]*dxinv[0]+dxinv[1]*dxinv[1]+dxinv[2]*dxinv[2];
 #endif
 
+        conv_cfl = std::max(conv_cfl, conv_lev);
         diff_cfl = std::max(diff_cfl, diff_lev*Real(2.0)*dxinv_norm);
+        forc_cfl = std::max(forc_cfl, forc_lev);
     }
 
-    Real cd_cfl;
-    if (explicit_diffusion) {
-        ParallelAllReduce::Max<Real>({conv_cfl,diff_cfl},
-                                     ParallelContext::CommunicatorSub());
-        cd_cfl = conv_cfl + diff_cfl;
-    } else {
-        ParallelAllReduce::Max<Real>(conv_cfl,
-                                     ParallelContext::CommunicatorSub());
-        cd_cfl = conv_cfl;
-    }
-
-    ParallelAllReduce::Max<Real>(forc_cfl,
+    // All three constraints are reduced in one call
+    ParallelAllReduce::Max<Real>({conv_cfl,diff_cfl,forc_cfl},
                                  ParallelContext::CommunicatorSub());
 
+    Real cd_cfl = (explicit_diffusion) ? conv_cfl + diff_cfl : conv_cfl;
+
     // Combined CFL conditioner
     Real comb_cfl = cd_cfl + std::sqrt(cd_cfl*cd_cfl + Real(4.0) * forc_cfl);
 
@@ -278,4 +231,6 @@ void incflo::ComputeDt (int initialization, bool explicit_diffusion)
     {
     m_dt = dt_new;
     }
+
+    m_telemetry.set_dt(m_dt, conv_cfl, (explicit_diffusion) ? diff_cfl : Real(0.0), forc_cfl);
 }
@@ -2,7 +2,7 @@
 
 using namespace amrex;
 
-void incflo::tracer_explicit_update (Vector<MultiFab> const& tra_forces)
+void incflo::tracer_explicit_update (Vector<MultiFab*> const& tra_forces)
 {
     if (m_advect_tracer == 0) { return; }
 
@@ -23,7 +23,7 @@ void incflo::tracer_explicit_update (Vector<MultiFab> const& tra_forces)
             Array4<Real> const& tra           = ld.tracer.array(mfi);
             Array4<Real const> const& rho     = ld.density.const_array(mfi);
             Array4<Real const> const& dtdt_o  = ld.conv_tracer_o.const_array(mfi);
-            Array4<Real const> const& tra_f   = tra_forces[lev].const_array(mfi);
+            Array4<Real const> const& tra_f   = tra_forces[lev]->const_array(mfi);
 
             auto const* iconserv = get_tracer_iconserv_device_ptr();
 
@@ -71,7 +71,7 @@ void incflo::tracer_explicit_update (Vector<MultiFab> const& tra_forces)
                     }
                 });
             }
-            else if (m_diff_type == DiffusionType::Implicit)
+            else if (m_diff_type == DiffusionType::Implicit || m_diff_type == DiffusionType::RKL2)
             {
                 ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
                 {
@@ -93,7 +93,7 @@ void incflo::tracer_explicit_update (Vector<MultiFab> const& tra_forces)
     } // lev
 }
 
-void incflo::tracer_explicit_update_corrector (Vector<MultiFab> const& tra_forces)
+void incflo::tracer_explicit_update_corrector (Vector<MultiFab*> const& tra_forces)
 {
     if (m_advect_tracer == 0) { return; }
 
@@ -115,7 +115,7 @@ void incflo::tracer_explicit_update_corrector (Vector<MultiFab> const& tra_force
             Array4<Real const> const& rho     = ld.density.const_array(mfi);
             Array4<Real const> const& dtdt_o  = ld.conv_tracer_o.const_array(mfi);
             Array4<Real const> const& dtdt    = ld.conv_tracer.const_array(mfi);
-            Array4<Real const> const& tra_f   = tra_forces[lev].const_array(mfi);
+            Array4<Real const> const& tra_f   = tra_forces[lev]->const_array(mfi);
             auto const* iconserv = get_tracer_iconserv_device_ptr();
 
             if (m_diff_type == DiffusionType::Explicit)
@@ -167,7 +167,7 @@ void incflo::tracer_explicit_update_corrector (Vector<MultiFab> const& tra_force
                     }
                 });
             }
-            else if (m_diff_type == DiffusionType::Implicit)
+            else if (m_diff_type == DiffusionType::Implicit || m_diff_type == DiffusionType::RKL2)
             {
                 ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
                 {
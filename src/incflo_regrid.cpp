@@ -35,6 +35,13 @@ void incflo::MakeNewLevelFromCoarse (int lev,
     }
     fillcoarsepatch_gradp(lev, time, new_leveldata->gp, 0);
 
+    // Keep the initial guess of the next MAC projection
+    if (m_mac_warm_start) {
+        fillcoarsepatch_mac_phi(lev, time, new_leveldata->mac_phi, 0);
+    } else {
+        new_leveldata->mac_phi.setVal(0.0);
+    }
+
     if (m_use_cc_proj) {
         new_leveldata->p_cc.setVal(0.0);
     } else {
@@ -46,6 +53,12 @@ void incflo::MakeNewLevelFromCoarse (int lev,
 
     m_diffusion_tensor_op.reset();
     m_diffusion_scalar_op.reset();
+    m_scratch.clear(lev);
+    m_bc_mask_cache.clear(lev);
+    m_nodal_projector.reset();
+    reset_mixed_precision_mac();
+    reset_diffusion_history();
+    reset_strainrate_cache();
 
     // Note: finest_level has not yet been updated and so we use lev
 #ifdef AMREX_USE_EB
@@ -88,6 +101,13 @@ void incflo::RemakeLevel (int lev, Real time, const BoxArray& ba,
     }
     fillpatch_gradp(lev, time, new_leveldata->gp, 0);
 
+    // Keep the initial guess of the next MAC projection
+    if (m_mac_warm_start) {
+        fillpatch_mac_phi(lev, time, new_leveldata->mac_phi, 0);
+    } else {
+        new_leveldata->mac_phi.setVal(0.0);
+    }
+
     if (m_use_cc_proj) {
         new_leveldata->p_cc.setVal(0.0);
     } else {
@@ -101,6 +121,12 @@ void incflo::RemakeLevel (int lev, Real time, const BoxArray& ba,
 
     m_diffusion_tensor_op.reset();
     m_diffusion_scalar_op.reset();
+    m_scratch.clear(lev);
+    m_bc_mask_cache.clear(lev);
+    m_nodal_projector.reset();
+    reset_mixed_precision_mac();
+    reset_diffusion_history();
+    reset_strainrate_cache();
 
 #ifdef AMREX_USE_EB
     macproj = std::make_unique<Hydro::MacProjector>(Geom(0,finest_level),
@@ -125,5 +151,11 @@ void incflo::ClearLevel (int lev)
     m_factory[lev].reset();
     m_diffusion_tensor_op.reset();
     m_diffusion_scalar_op.reset();
+    m_scratch.clear(lev);
+    m_bc_mask_cache.clear(lev);
     macproj.reset();
+    m_nodal_projector.reset();
+    reset_mixed_precision_mac();
+    reset_diffusion_history();
+    reset_strainrate_cache();
 }
@@ -0,0 +1,44 @@
+#include <incflo_scratch_pool.H>
+
+using namespace amrex;
+
+MultiFab&
+ScratchPool::get (int lev, std::string const& name,
+                  BoxArray const& ba, DistributionMapping const& dm,
+                  int ncomp, int nghost,
+                  FabFactory<FArrayBox> const& factory)
+{
+    IndexType const ixtype = ba.ixType();
+    int ixbits = 0;
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        if (ixtype.nodeCentered(idim)) { ixbits |= (1 << idim); }
+    }
+
+    auto& mf = m_pool[Key(lev, name, ixbits, ncomp, nghost)];
+
+    // Re-define only if the grids have changed underneath us, e.g. if clear()
+    // was not called after a regrid.
+    if (!mf || mf->boxArray() != ba || mf->DistributionMap() != dm) {
+        mf = std::make_unique<MultiFab>(ba, dm, ncomp, nghost, MFInfo(), factory);
+    }
+
+    return *mf;
+}
+
+void
+ScratchPool::clear (int lev)
+{
+    for (auto it = m_pool.begin(); it != m_pool.end(); ) {
+        if (std::get<0>(it->first) == lev) {
+            it = m_pool.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void
+ScratchPool::clear ()
+{
+    m_pool.clear();
+}
@@ -12,41 +12,10 @@ void incflo::ErrorEst (int levc, TagBoxArray& tags, Real time, int /*ngrow*/)
 {
     BL_PROFILE("incflo::ErrorEst()");
 
-    static bool first = true;
-    static Vector<Real> rhoerr_v, gradrhoerr_v;
-
-    static bool tag_region;
-
-    if (first) {
-        first = false;
-        ParmParse pp("incflo");
-
-        pp.queryarr("rhoerr", rhoerr_v);
-        if (!rhoerr_v.empty()) {
-            Real last = rhoerr_v.back();
-            rhoerr_v.resize(max_level+1, last);
-        }
-
-        pp.queryarr("gradrhoerr", gradrhoerr_v);
-        if (!gradrhoerr_v.empty()) {
-            Real last = gradrhoerr_v.back();
-            gradrhoerr_v.resize(max_level+1, last);
-        }
-
-        tag_region_lo.resize(3);
-        tag_region_hi.resize(3);
-
-        tag_region = false;
-        pp.query("tag_region", tag_region);
-
-        pp.queryarr("tag_region_lo", tag_region_lo);
-        pp.queryarr("tag_region_hi", tag_region_hi);
-    }
-
     const auto   tagval = TagBox::SET;
 
-    bool tag_rho = levc < rhoerr_v.size();
-    bool tag_gradrho = levc < gradrhoerr_v.size();
+    bool tag_rho = levc < m_rhoerr.size();
+    bool tag_gradrho = levc < m_gradrhoerr.size();
 
     if (tag_gradrho) {
         fillpatch_density(levc, time, m_leveldata[levc]->density, 1);
@@ -67,8 +36,8 @@ void incflo::ErrorEst (int levc, TagBoxArray& tags, Real time, int /*ngrow*/)
         if (tag_rho || tag_gradrho)
         {
             Array4<Real const> const& rho = m_leveldata[levc]->density.const_array(mfi);
-            Real rhoerr = tag_rho ? rhoerr_v[levc]: std::numeric_limits<Real>::max();
-            Real gradrhoerr = tag_gradrho ? gradrhoerr_v[levc] : std::numeric_limits<Real>::max();
+            Real rhoerr = tag_rho ? m_rhoerr[levc]: std::numeric_limits<Real>::max();
+            Real gradrhoerr = tag_gradrho ? m_gradrhoerr[levc] : std::numeric_limits<Real>::max();
             ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
             {
                 if (tag_rho && rho(i,j,k) > rhoerr) {
@@ -94,7 +63,7 @@ void incflo::ErrorEst (int levc, TagBoxArray& tags, Real time, int /*ngrow*/)
             });
         }
 
-        if (tag_region) {
+        if (m_tag_region) {
 
             Real xlo = tag_region_lo[0];
             Real ylo = tag_region_lo[1];
@@ -2,7 +2,8 @@
 
 using namespace amrex;
 
-void incflo::update_tracer (StepType step_type, Vector<MultiFab>& tra_eta, Vector<MultiFab>& tra_forces)
+void incflo::update_tracer (StepType step_type, Vector<MultiFab*> const& tra_eta,
+                            Vector<MultiFab*> const& tra_forces)
 {
     BL_PROFILE("incflo::update_tracer");
 
@@ -17,14 +18,14 @@ void incflo::update_tracer (StepType step_type, Vector<MultiFab>& tra_eta, Vecto
         // *************************************************************************************
         // Compute the tracer forcing terms (forcing for (rho s), not for s)
         // *************************************************************************************
-        compute_tra_forces(GetVecOfPtrs(tra_forces),  get_density_nph_const());
+        compute_tra_forces(tra_forces,  get_density_nph_const());
 
         // *************************************************************************************
         // Compute explicit diffusive term (if corrector)
         // *************************************************************************************
         if (step_type == StepType::Corrector)
         {
-            compute_tracer_diff_coeff(GetVecOfPtrs(tra_eta),1);
+            compute_tracer_diff_coeff(tra_eta,1);
             if (m_diff_type == DiffusionType::Explicit) {
                 compute_laps(get_laps_new(), get_tracer_new_const(), GetVecOfConstPtrs(tra_eta));
             }
@@ -55,6 +56,15 @@ void incflo::update_tracer (StepType step_type, Vector<MultiFab>& tra_eta, Vecto
         }
         else
         {
+            if (m_diff_type == DiffusionType::RKL2)
+            {
+                const int ng_diffusion = 1;
+                for (int lev = 0; lev <= finest_level; ++lev)
+                    fillphysbc_tracer(lev, new_time, m_leveldata[lev]->tracer, ng_diffusion);
+
+                diffuse_scalar_rkl2(get_tracer_new(), get_density_new(), GetVecOfConstPtrs(tra_eta), m_dt);
+            }
+
             // Need to average down tracer since the diffusion solver didn't do it for us.
             for (int lev = finest_level-1; lev >= 0; --lev) {
 #ifdef AMREX_USE_EB
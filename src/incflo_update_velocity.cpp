@@ -2,7 +2,8 @@
 
 using namespace amrex;
 
-void incflo::update_velocity (StepType step_type, Vector<MultiFab>& vel_eta, Vector<MultiFab>& vel_forces)
+void incflo::update_velocity (StepType step_type, Vector<MultiFab*> const& vel_eta,
+                              Vector<MultiFab*> const& vel_forces)
 {
     BL_PROFILE("incflo::update_velocity");
 
@@ -17,7 +18,7 @@ void incflo::update_velocity (StepType step_type, Vector<MultiFab>& vel_eta, Vec
         // Define (or if advection_type != "MOL", re-define) the forcing terms, without the viscous terms
         //    and using the half-time density
         // *************************************************************************************
-        compute_vel_forces(GetVecOfPtrs(vel_forces), get_velocity_old_const(),
+        compute_vel_forces(vel_forces, get_velocity_old_const(),
                            get_density_nph_const(), get_tracer_old_const(), get_tracer_new_const());
 
         // *************************************************************************************
@@ -33,13 +34,14 @@ void incflo::update_velocity (StepType step_type, Vector<MultiFab>& vel_eta, Vec
         {
             Box const& bx = mfi.tilebox();
             Array4<Real> const& vel = ld.velocity.array(mfi);
+            Array4<Real const> const& vel_o = ld.velocity_o.const_array(mfi);
             Array4<Real const> const& dvdt = ld.conv_velocity_o.const_array(mfi);
-            Array4<Real const> const& vel_f = vel_forces[lev].const_array(mfi);
+            Array4<Real const> const& vel_f = vel_forces[lev]->const_array(mfi);
             Array4<Real const> const& rho_old  = ld.density_o.const_array(mfi);
             Array4<Real const> const& rho_new  = ld.density.const_array(mfi);
             Array4<Real const> const& rho_nph  = ld.density_nph.const_array(mfi);
 
-            if (m_diff_type == DiffusionType::Implicit) {
+            if (m_diff_type == DiffusionType::Implicit || m_diff_type == DiffusionType::RKL2) {
 
                 if (use_tensor_correction)
                 {
@@ -48,12 +50,9 @@ void incflo::update_velocity (StepType step_type, Vector<MultiFab>& vel_eta, Vec
                     if (m_advect_momentum) {
                         ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
                         {
-                            AMREX_D_TERM(vel(i,j,k,0) *= rho_old(i,j,k);,
-                                         vel(i,j,k,1) *= rho_old(i,j,k);,
-                                         vel(i,j,k,2) *= rho_old(i,j,k););
-                            AMREX_D_TERM(vel(i,j,k,0) += l_dt*(dvdt(i,j,k,0)+rho_nph(i,j,k)*vel_f(i,j,k,0)+divtau_o(i,j,k,0));,
-                                         vel(i,j,k,1) += l_dt*(dvdt(i,j,k,1)+rho_nph(i,j,k)*vel_f(i,j,k,1)+divtau_o(i,j,k,1));,
-                                         vel(i,j,k,2) += l_dt*(dvdt(i,j,k,2)+rho_nph(i,j,k)*vel_f(i,j,k,2)+divtau_o(i,j,k,2)););
+                            AMREX_D_TERM(vel(i,j,k,0) = rho_old(i,j,k)*vel_o(i,j,k,0) + l_dt*(dvdt(i,j,k,0)+rho_nph(i,j,k)*vel_f(i,j,k,0)+divtau_o(i,j,k,0));,
+                                         vel(i,j,k,1) = rho_old(i,j,k)*vel_o(i,j,k,1) + l_dt*(dvdt(i,j,k,1)+rho_nph(i,j,k)*vel_f(i,j,k,1)+divtau_o(i,j,k,1));,
+                                         vel(i,j,k,2) = rho_old(i,j,k)*vel_o(i,j,k,2) + l_dt*(dvdt(i,j,k,2)+rho_nph(i,j,k)*vel_f(i,j,k,2)+divtau_o(i,j,k,2)););
                             AMREX_D_TERM(vel(i,j,k,0) /= rho_new(i,j,k);,
                                          vel(i,j,k,1) /= rho_new(i,j,k);,
                                          vel(i,j,k,2) /= rho_new(i,j,k););
@@ -61,21 +60,18 @@ void incflo::update_velocity (StepType step_type, Vector<MultiFab>& vel_eta, Vec
                     } else {
                         ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
                         {
-                            AMREX_D_TERM(vel(i,j,k,0) += l_dt*(dvdt(i,j,k,0)+vel_f(i,j,k,0)+divtau_o(i,j,k,0));,
-                                         vel(i,j,k,1) += l_dt*(dvdt(i,j,k,1)+vel_f(i,j,k,1)+divtau_o(i,j,k,1));,
-                                         vel(i,j,k,2) += l_dt*(dvdt(i,j,k,2)+vel_f(i,j,k,2)+divtau_o(i,j,k,2)););
+                            AMREX_D_TERM(vel(i,j,k,0) = vel_o(i,j,k,0) + l_dt*(dvdt(i,j,k,0)+vel_f(i,j,k,0)+divtau_o(i,j,k,0));,
+                                         vel(i,j,k,1) = vel_o(i,j,k,1) + l_dt*(dvdt(i,j,k,1)+vel_f(i,j,k,1)+divtau_o(i,j,k,1));,
+                                         vel(i,j,k,2) = vel_o(i,j,k,2) + l_dt*(dvdt(i,j,k,2)+vel_f(i,j,k,2)+divtau_o(i,j,k,2)););
                         });
                     }
                 } else {
                     if (m_advect_momentum) {
                         ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
                         {
-                            AMREX_D_TERM(vel(i,j,k,0) *= rho_old(i,j,k);,
-                                         vel(i,j,k,1) *= rho_old(i,j,k);,
-                                         vel(i,j,k,2) *= rho_old(i,j,k););
-                            AMREX_D_TERM(vel(i,j,k,0) += l_dt*(dvdt(i,j,k,0)+rho_nph(i,j,k)*vel_f(i,j,k,0));,
-                                         vel(i,j,k,1) += l_dt*(dvdt(i,j,k,1)+rho_nph(i,j,k)*vel_f(i,j,k,1));,
-                                         vel(i,j,k,2) += l_dt*(dvdt(i,j,k,2)+rho_nph(i,j,k)*vel_f(i,j,k,2)););
+                            AMREX_D_TERM(vel(i,j,k,0) = rho_old(i,j,k)*vel_o(i,j,k,0) + l_dt*(dvdt(i,j,k,0)+rho_nph(i,j,k)*vel_f(i,j,k,0));,
+                                         vel(i,j,k,1) = rho_old(i,j,k)*vel_o(i,j,k,1) + l_dt*(dvdt(i,j,k,1)+rho_nph(i,j,k)*vel_f(i,j,k,1));,
+                                         vel(i,j,k,2) = rho_old(i,j,k)*vel_o(i,j,k,2) + l_dt*(dvdt(i,j,k,2)+rho_nph(i,j,k)*vel_f(i,j,k,2)););
                             AMREX_D_TERM(vel(i,j,k,0) /= rho_new(i,j,k);,
                                          vel(i,j,k,1) /= rho_new(i,j,k);,
                                          vel(i,j,k,2) /= rho_new(i,j,k););
@@ -83,9 +79,9 @@ void incflo::update_velocity (StepType step_type, Vector<MultiFab>& vel_eta, Vec
                     } else {
                         ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
                         {
-                            AMREX_D_TERM(vel(i,j,k,0) += l_dt*(dvdt(i,j,k,0)+vel_f(i,j,k,0));,
-                                         vel(i,j,k,1) += l_dt*(dvdt(i,j,k,1)+vel_f(i,j,k,1));,
-                                         vel(i,j,k,2) += l_dt*(dvdt(i,j,k,2)+vel_f(i,j,k,2)););
+                            AMREX_D_TERM(vel(i,j,k,0) = vel_o(i,j,k,0) + l_dt*(dvdt(i,j,k,0)+vel_f(i,j,k,0));,
+                                         vel(i,j,k,1) = vel_o(i,j,k,1) + l_dt*(dvdt(i,j,k,1)+vel_f(i,j,k,1));,
+                                         vel(i,j,k,2) = vel_o(i,j,k,2) + l_dt*(dvdt(i,j,k,2)+vel_f(i,j,k,2)););
                         });
                     }
                 }
@@ -97,12 +93,9 @@ void incflo::update_velocity (StepType step_type, Vector<MultiFab>& vel_eta, Vec
                 if (m_advect_momentum) {
                     ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
                     {
-                        AMREX_D_TERM(vel(i,j,k,0) *= rho_old(i,j,k);,
-                                     vel(i,j,k,1) *= rho_old(i,j,k);,
-                                     vel(i,j,k,2) *= rho_old(i,j,k););
-                        AMREX_D_TERM(vel(i,j,k,0) += l_dt*(dvdt(i,j,k,0)+rho_nph(i,j,k)*vel_f(i,j,k,0)+l_half*divtau_o(i,j,k,0));,
-                                     vel(i,j,k,1) += l_dt*(dvdt(i,j,k,1)+rho_nph(i,j,k)*vel_f(i,j,k,1)+l_half*divtau_o(i,j,k,1));,
-                                     vel(i,j,k,2) += l_dt*(dvdt(i,j,k,2)+rho_nph(i,j,k)*vel_f(i,j,k,2)+l_half*divtau_o(i,j,k,2)););
+                        AMREX_D_TERM(vel(i,j,k,0) = rho_old(i,j,k)*vel_o(i,j,k,0) + l_dt*(dvdt(i,j,k,0)+rho_nph(i,j,k)*vel_f(i,j,k,0)+l_half*divtau_o(i,j,k,0));,
+                                     vel(i,j,k,1) = rho_old(i,j,k)*vel_o(i,j,k,1) + l_dt*(dvdt(i,j,k,1)+rho_nph(i,j,k)*vel_f(i,j,k,1)+l_half*divtau_o(i,j,k,1));,
+                                     vel(i,j,k,2) = rho_old(i,j,k)*vel_o(i,j,k,2) + l_dt*(dvdt(i,j,k,2)+rho_nph(i,j,k)*vel_f(i,j,k,2)+l_half*divtau_o(i,j,k,2)););
                         AMREX_D_TERM(vel(i,j,k,0) /= rho_new(i,j,k);,
                                      vel(i,j,k,1) /= rho_new(i,j,k);,
                                      vel(i,j,k,2) /= rho_new(i,j,k););
@@ -110,9 +103,9 @@ void incflo::update_velocity (StepType step_type, Vector<MultiFab>& vel_eta, Vec
                 } else {
                     ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
                     {
-                        AMREX_D_TERM(vel(i,j,k,0) += l_dt*(dvdt(i,j,k,0)+vel_f(i,j,k,0)+l_half*divtau_o(i,j,k,0));,
-                                     vel(i,j,k,1) += l_dt*(dvdt(i,j,k,1)+vel_f(i,j,k,1)+l_half*divtau_o(i,j,k,1));,
-                                     vel(i,j,k,2) += l_dt*(dvdt(i,j,k,2)+vel_f(i,j,k,2)+l_half*divtau_o(i,j,k,2)););
+                        AMREX_D_TERM(vel(i,j,k,0) = vel_o(i,j,k,0) + l_dt*(dvdt(i,j,k,0)+vel_f(i,j,k,0)+l_half*divtau_o(i,j,k,0));,
+                                     vel(i,j,k,1) = vel_o(i,j,k,1) + l_dt*(dvdt(i,j,k,1)+vel_f(i,j,k,1)+l_half*divtau_o(i,j,k,1));,
+                                     vel(i,j,k,2) = vel_o(i,j,k,2) + l_dt*(dvdt(i,j,k,2)+vel_f(i,j,k,2)+l_half*divtau_o(i,j,k,2)););
                     });
                 }
             }
@@ -122,12 +115,9 @@ void incflo::update_velocity (StepType step_type, Vector<MultiFab>& vel_eta, Vec
                 if (m_advect_momentum) {
                     ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
                     {
-                        AMREX_D_TERM(vel(i,j,k,0) *= rho_old(i,j,k);,
-                                     vel(i,j,k,1) *= rho_old(i,j,k);,
-                                     vel(i,j,k,2) *= rho_old(i,j,k););
-                        AMREX_D_TERM(vel(i,j,k,0) += l_dt*(dvdt(i,j,k,0)+rho_nph(i,j,k)*vel_f(i,j,k,0)+divtau_o(i,j,k,0));,
-                                     vel(i,j,k,1) += l_dt*(dvdt(i,j,k,1)+rho_nph(i,j,k)*vel_f(i,j,k,1)+divtau_o(i,j,k,1));,
-                                     vel(i,j,k,2) += l_dt*(dvdt(i,j,k,2)+rho_nph(i,j,k)*vel_f(i,j,k,2)+divtau_o(i,j,k,2)););
+                        AMREX_D_TERM(vel(i,j,k,0) = rho_old(i,j,k)*vel_o(i,j,k,0) + l_dt*(dvdt(i,j,k,0)+rho_nph(i,j,k)*vel_f(i,j,k,0)+divtau_o(i,j,k,0));,
+                                     vel(i,j,k,1) = rho_old(i,j,k)*vel_o(i,j,k,1) + l_dt*(dvdt(i,j,k,1)+rho_nph(i,j,k)*vel_f(i,j,k,1)+divtau_o(i,j,k,1));,
+                                     vel(i,j,k,2) = rho_old(i,j,k)*vel_o(i,j,k,2) + l_dt*(dvdt(i,j,k,2)+rho_nph(i,j,k)*vel_f(i,j,k,2)+divtau_o(i,j,k,2)););
                         AMREX_D_TERM(vel(i,j,k,0) /= rho_new(i,j,k);,
                                      vel(i,j,k,1) /= rho_new(i,j,k);,
                                      vel(i,j,k,2) /= rho_new(i,j,k););
@@ -135,9 +125,9 @@ void incflo::update_velocity (StepType step_type, Vector<MultiFab>& vel_eta, Vec
                 } else {
                     ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
                     {
-                        AMREX_D_TERM(vel(i,j,k,0) += l_dt*(dvdt(i,j,k,0)+vel_f(i,j,k,0)+divtau_o(i,j,k,0));,
-                                     vel(i,j,k,1) += l_dt*(dvdt(i,j,k,1)+vel_f(i,j,k,1)+divtau_o(i,j,k,1));,
-                                     vel(i,j,k,2) += l_dt*(dvdt(i,j,k,2)+vel_f(i,j,k,2)+divtau_o(i,j,k,2)););
+                        AMREX_D_TERM(vel(i,j,k,0) = vel_o(i,j,k,0) + l_dt*(dvdt(i,j,k,0)+vel_f(i,j,k,0)+divtau_o(i,j,k,0));,
+                                     vel(i,j,k,1) = vel_o(i,j,k,1) + l_dt*(dvdt(i,j,k,1)+vel_f(i,j,k,1)+divtau_o(i,j,k,1));,
+                                     vel(i,j,k,2) = vel_o(i,j,k,2) + l_dt*(dvdt(i,j,k,2)+vel_f(i,j,k,2)+divtau_o(i,j,k,2)););
                     });
                 }
             }
@@ -149,7 +139,7 @@ void incflo::update_velocity (StepType step_type, Vector<MultiFab>& vel_eta, Vec
         // *************************************************************************************
         // Define the forcing terms to use in the final update (using half-time density)
         // *************************************************************************************
-        compute_vel_forces(GetVecOfPtrs(vel_forces), get_velocity_new_const(),
+        compute_vel_forces(vel_forces, get_velocity_new_const(),
                            get_density_nph_const(), get_tracer_old_const(), get_tracer_new_const());
 
         for (int lev = 0; lev <= finest_level; lev++)
@@ -166,7 +156,7 @@ void incflo::update_velocity (StepType step_type, Vector<MultiFab>& vel_eta, Vec
             Array4<Real const> const& vel_o = ld.velocity_o.const_array(mfi);
             Array4<Real const> const& dvdt = ld.conv_velocity.const_array(mfi);
             Array4<Real const> const& dvdt_o = ld.conv_velocity_o.const_array(mfi);
-            Array4<Real const> const& vel_f = vel_forces[lev].const_array(mfi);
+            Array4<Real const> const& vel_f = vel_forces[lev]->const_array(mfi);
 
             Array4<Real const> const& rho_old  = ld.density_o.const_array(mfi);
             Array4<Real const> const& rho_new  = ld.density.const_array(mfi);
@@ -251,7 +241,7 @@ void incflo::update_velocity (StepType step_type, Vector<MultiFab>& vel_eta, Vec
                     });
                 }
             }
-            else if (m_diff_type == DiffusionType::Implicit)
+            else if (m_diff_type == DiffusionType::Implicit || m_diff_type == DiffusionType::RKL2)
             {
                 if (use_tensor_correction)
                 {
@@ -337,5 +327,15 @@ void incflo::update_velocity (StepType step_type, Vector<MultiFab>& vel_eta, Vec
         Real dt_diff = (m_diff_type == DiffusionType::Implicit) ? m_dt : l_half*m_dt;
         diffuse_velocity(get_velocity_new(), get_density_new(), GetVecOfConstPtrs(vel_eta), dt_diff);
     }
+    else if (m_diff_type == DiffusionType::RKL2)
+    {
+        const int ng_diffusion = 1;
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            fillphysbc_velocity(lev, new_time, m_leveldata[lev]->velocity, ng_diffusion);
+            fillphysbc_density (lev, new_time, m_leveldata[lev]->density , ng_diffusion);
+        }
+
+        diffuse_velocity_rkl2(get_velocity_new(), get_density_new(), GetVecOfConstPtrs(vel_eta), m_dt);
+    }
 }
 
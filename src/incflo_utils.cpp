@@ -287,12 +287,15 @@ void incflo::copy_from_new_to_old_velocity (IntVect const& ng)
     for (int lev = 0; lev <= finest_level; ++lev) {
         copy_from_new_to_old_velocity(lev, ng);
     }
+    // All levels now hold the same (new) data
+    m_velocity_version.old_state = ++m_velocity_version.counter;
 }
 
 void incflo::copy_from_new_to_old_velocity (int lev, IntVect const& ng)
 {
     MultiFab::Copy(m_leveldata[lev]->velocity_o,
                    m_leveldata[lev]->velocity, 0, 0, AMREX_SPACEDIM, ng);
+    m_velocity_version.old_state = -1;
 }
 
 void incflo::copy_from_old_to_new_velocity (IntVect const& ng)
@@ -306,6 +309,7 @@ void incflo::copy_from_old_to_new_velocity (int lev, IntVect const& ng)
 {
     MultiFab::Copy(m_leveldata[lev]->velocity,
                    m_leveldata[lev]->velocity_o, 0, 0, AMREX_SPACEDIM, ng);
+    new_velocity_changed();
 }
 
 void incflo::copy_from_new_to_old_density (IntVect const& ng)
@@ -363,3 +367,46 @@ void incflo::copy_from_old_to_new_tracer (int lev, IntVect const& ng)
                        m_leveldata[lev]->tracer_o, 0, 0, m_ntrac, ng);
     }
 }
+
+void incflo::swap_new_and_old_state ()
+{
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        swap_new_and_old_state(lev);
+    }
+    std::swap(m_velocity_version.new_state, m_velocity_version.old_state);
+}
+
+void incflo::swap_new_and_old_state (int lev)
+{
+    auto& ld = *m_leveldata[lev];
+
+    std::swap(ld.velocity, ld.velocity_o);
+
+    // The predictor never writes the new density if it is constant, nor the new
+    // tracer if it is not advected, so those must stay equal to the old ones
+    if (m_constant_density) {
+        copy_from_new_to_old_density(lev);
+    } else {
+        std::swap(ld.density, ld.density_o);
+    }
+
+    if (m_advect_tracer) {
+        std::swap(ld.tracer, ld.tracer_o);
+    } else {
+        copy_from_new_to_old_tracer(lev);
+    }
+
+    ld.ng_valid_old = 0;
+}
+
+Vector<MultiFab*> incflo::get_scratch (std::string const& name, IndexType ixtype,
+                                       int ncomp, int nghost)
+{
+    Vector<MultiFab*> r;
+    r.reserve(finest_level+1);
+    for (int lev = 0; lev <= finest_level; ++lev) {
+        r.push_back(&(m_scratch.get(lev, name, amrex::convert(grids[lev], ixtype), dmap[lev],
+                                    ncomp, nghost, Factory(lev))));
+    }
+    return r;
+}
@@ -1,6 +1,8 @@
 #include <incflo.H>
 #include <AMReX_buildInfo.H>
 
+#include <map>
+
 void writeBuildInfo();
 
 using namespace amrex;
@@ -10,8 +12,243 @@ void add_par () {
    if(not pp.contains("extend_domain_face")) {
       pp.add("extend_domain_face",true);
    }
+
+   // Asynchronous output needs the AMReX I/O thread, which is only
+   // created if amrex.async_out is set when AMReX is initialized
+   ParmParse pp_amr("amr");
+   bool async_output = false;
+   pp_amr.query("async_output", async_output);
+   ParmParse pp_amrex("amrex");
+   if (async_output && not pp_amrex.contains("async_out")) {
+      pp_amrex.add("async_out", 1);
+   }
+}
+
+namespace {
+
+// Run one simulation on the current (sub-)communicator. amr.max_walltime is
+// counted from wall_start, so that the members of an ensemble share it.
+void run_incflo (double wall_start)
+{
+    // Start timing the program
+    Real start_time = Real(ParallelDescriptor::second());
+
+    // Note inheritance: incflo : AmrCore : AmrMesh.
+    incflo my_incflo(wall_start);
+
+    // Initialize data, parameters, arrays and derived internals
+    my_incflo.InitData();
+
+    // Time spent on initialization
+    Real init_time = Real(ParallelDescriptor::second()) - start_time;
+
+    // Evolve system to final time
+    my_incflo.Evolve();
+
+    // Time spent in total
+    Real end_time = Real(ParallelDescriptor::second()) - start_time;
+
+    ParallelReduce::Max<Real>(init_time, ParallelContext::IOProcessorNumberSub(),
+                              ParallelContext::CommunicatorSub());
+    ParallelReduce::Max<Real>(end_time, ParallelContext::IOProcessorNumberSub(),
+                              ParallelContext::CommunicatorSub());
+
+    // Print timing results
+    amrex::Print() << "Time spent in InitData():    " << init_time << std::endl;
+    amrex::Print() << "Time spent in Evolve():      " << end_time - init_time << std::endl;
+}
+
+//
+// Ensemble members are described in the inputs file by
+//
+//     ensemble.size    = N
+//     ensemble.ngroups = G      (optional, default 1)
+//     ensemble.member<i>.<name> = <value>   for i = 0, ..., N-1
+//
+// Member i runs with every "ensemble.member<i>.<name>" entry in place of
+// "<name>". Unless overridden, the plotfile, checkpoint and telemetry names
+// get an "_m<i>" suffix so that members do not overwrite each other's output.
+//
+// The members share the problem domain and the EB geometry, which are set
+// up once per process by the first member that runs there, so they cannot
+// override the inputs these are built from. With G = 1 the members run one after the other on all ranks;
+// otherwise the ranks are split into G groups that each run every G-th
+// member concurrently. Either way amr.max_walltime applies to the ensemble
+// as a whole.
+//
+class EnsembleOverrides
+{
+public:
+    explicit EnsembleOverrides (int member)
+    {
+        ParmParse pp;
+        const std::string prefix = "ensemble.member" + std::to_string(member) + ".";
+
+        std::map<std::string, std::vector<std::string> > overrides;
+        for (auto const& full_name : pp.getEntries()) {
+            if (full_name.size() > prefix.size() && full_name.compare(0, prefix.size(), prefix) == 0) {
+                std::vector<std::string> values;
+                pp.getarr(full_name.c_str(), values);
+                overrides[full_name.substr(prefix.size())] = values;
+            }
+        }
+
+        // Keep the output of the members apart
+        const std::string suffix = "_m" + std::to_string(member);
+        for (std::string const& name : {"amr.plot_file", "amr.smallplot_file",
+                                        "amr.check_file", "amr.telemetry_file"})
+        {
+            if (overrides.count(name) == 0) {
+                std::string base;
+                if (name == "amr.plot_file") {
+                    base = "plt";
+                } else if (name == "amr.smallplot_file") {
+                    base = "smallplt";
+                } else if (name == "amr.check_file") {
+                    base = "chk";
+                }
+                pp.query(name.c_str(), base);
+                if (!base.empty()) {
+                    overrides[name] = {base + suffix};
+                }
+            }
+        }
+
+        for (auto const& [name, values] : overrides) {
+            if (pp.contains(name.c_str())) {
+                std::vector<std::string> old_values;
+                pp.getarr(name.c_str(), old_values);
+                m_saved[name] = old_values;
+                pp.remove(name);
+            }
+            pp.addarr(name.c_str(), values);
+            m_added.push_back(name);
+        }
+    }
+
+    ~EnsembleOverrides ()
+    {
+        ParmParse pp;
+        for (auto const& name : m_added) {
+            pp.remove(name);
+        }
+        for (auto const& [name, values] : m_saved) {
+            pp.addarr(name.c_str(), values);
+        }
+    }
+
+    // Names of the inputs given for this member
+    [[nodiscard]] std::vector<std::string> const& names () const { return m_added; }
+
+    EnsembleOverrides (EnsembleOverrides const&) = delete;
+    EnsembleOverrides (EnsembleOverrides&&) = delete;
+    EnsembleOverrides& operator= (EnsembleOverrides const&) = delete;
+    EnsembleOverrides& operator= (EnsembleOverrides&&) = delete;
+
+private:
+    std::vector<std::string> m_added;
+    std::map<std::string, std::vector<std::string> > m_saved;
+};
+
+// Plotfiles, checkpoints and restarts go through VisMF, which works on all
+// of MPI_COMM_WORLD and can therefore not be used by concurrent members. This
+// includes the checkpoints written before the walltime runs out or on signals.
+bool member_uses_file_io ()
+{
+    ParmParse pp("amr");
+    int check_int = -1, plot_int = -1, smallplot_int = -1;
+    Real plot_per_exact = -1., plot_per_approx = -1., smallplot_per_approx = -1.;
+    Real max_walltime = -1.;
+    bool checkpoint_on_signal = false;
+    std::string restart;
+    pp.query("check_int", check_int);
+    pp.query("plot_int", plot_int);
+    pp.query("plot_per_exact", plot_per_exact);
+    pp.query("plot_per_approx", plot_per_approx);
+    pp.query("smallplot_int", smallplot_int);
+    pp.query("smallplot_per_approx", smallplot_per_approx);
+    pp.query("restart", restart);
+    pp.query("max_walltime", max_walltime);
+    pp.query("checkpoint_on_signal", checkpoint_on_signal);
+    return check_int > 0 || plot_int > 0 || plot_per_exact > 0 || plot_per_approx > 0 ||
+           smallplot_int > 0 || smallplot_per_approx > 0 || !restart.empty() ||
+           max_walltime > 0 || checkpoint_on_signal;
 }
 
+// Inputs the members cannot override. The problem domain (geometry.*) is
+// set up once per process by Geometry::Setup, and with EB the shared EB index
+// space is built from the shape inputs and the geometry of the finest level.
+bool is_shared_geometry_input (std::string const& name)
+{
+    if (name.compare(0, 9, "geometry.") == 0) { return true; }
+#ifdef AMREX_USE_EB
+    for (std::string const& prefix : {"eb2.", "box.", "cylinder.", "annulus.",
+                                      "sphere.", "twocylinders.", "jcap.", "csg."})
+    {
+        if (name.compare(0, prefix.size(), prefix) == 0) { return true; }
+    }
+    return name == "amr.n_cell" || name == "amr.max_level" || name == "amr.ref_ratio" ||
+           name == "amr.ref_ratio_vect" || name == "incflo.geometry" ||
+           name == "incflo.geometry_filename";
+#else
+    return false;
+#endif
+}
+
+void run_ensemble (int size, int ngroups, double wall_start)
+{
+    AMREX_ALWAYS_ASSERT(ngroups >= 1 && ngroups <= ParallelDescriptor::NProcs());
+
+    int group = 0;
+#ifdef AMREX_USE_MPI
+    MPI_Comm group_comm = MPI_COMM_NULL;
+    if (ngroups > 1) {
+        group = static_cast<int>((static_cast<Long>(ParallelDescriptor::MyProc()) * ngroups)
+                                 / ParallelDescriptor::NProcs());
+        MPI_Comm_split(ParallelDescriptor::Communicator(), group,
+                       ParallelDescriptor::MyProc(), &group_comm);
+        ParallelContext::push(group_comm);
+    }
+#else
+    if (ngroups > 1) {
+        amrex::Abort("ensemble.ngroups > 1 requires MPI");
+    }
+#endif
+
+    for (int member = group; member < size; member += ngroups)
+    {
+        EnsembleOverrides overrides(member);
+
+        if (ngroups > 1 && member_uses_file_io()) {
+            amrex::Abort("Ensemble members running concurrently (ensemble.ngroups > 1) "
+                         "cannot write plotfiles or checkpoints or restart, which includes "
+                         "amr.max_walltime and amr.checkpoint_on_signal");
+        }
+
+        for (auto const& name : overrides.names()) {
+            if (is_shared_geometry_input(name)) {
+                amrex::Abort("ensemble.member" + std::to_string(member) + "." + name +
+                             ": ensemble members share the problem domain (and EB geometry) "
+                             "and cannot override the inputs it is built from");
+            }
+        }
+
+        amrex::Print() << "\n============   ENSEMBLE MEMBER " << member
+                       << " OF " << size << "   ============\n" << std::endl;
+
+        run_incflo(wall_start);
+    }
+
+#ifdef AMREX_USE_MPI
+    if (ngroups > 1) {
+        ParallelContext::pop();
+        MPI_Comm_free(&group_comm);
+    }
+#endif
+}
+
+} // namespace
+
 int main(int argc, char* argv[])
 {
 
@@ -31,6 +268,9 @@ int main(int argc, char* argv[])
 
         BL_PROFILE("main()");
 
+        // amr.max_walltime is counted from here, also for ensembles
+        double wall_start = ParallelDescriptor::second();
+
         // Issue an error if input file is not given
         if(argc < 2) amrex::Abort("Input file must be given as command-line argument.");
 
@@ -38,30 +278,18 @@ int main(int argc, char* argv[])
         const char* githash_incflo = buildInfoGetGitHash(1);
         amrex::Print() << "incflo git hash: " << githash_incflo << "\n";
 
-        // Start timing the program
-        Real start_time = Real(ParallelDescriptor::second());
-
-        // Default constructor. Note inheritance: incflo : AmrCore : AmrMesh.
-        incflo my_incflo;
-
-        // Initialize data, parameters, arrays and derived internals
-        my_incflo.InitData();
-
-        // Time spent on initialization
-        Real init_time = Real(ParallelDescriptor::second()) - start_time;
+        // Run several variants of the same problem in one go?
+        ParmParse pp("ensemble");
+        int ensemble_size = 0;
+        int ensemble_ngroups = 1;
+        pp.query("size", ensemble_size);
+        pp.query("ngroups", ensemble_ngroups);
 
-        // Evolve system to final time
-        my_incflo.Evolve();
-
-        // Time spent in total
-        Real end_time = Real(ParallelDescriptor::second()) - start_time;
-
-        ParallelDescriptor::ReduceRealMax(init_time, ParallelDescriptor::IOProcessorNumber());
-        ParallelDescriptor::ReduceRealMax(end_time, ParallelDescriptor::IOProcessorNumber());
-
-        // Print timing results
-        amrex::Print() << "Time spent in InitData():    " << init_time << std::endl;
-        amrex::Print() << "Time spent in Evolve():      " << end_time - init_time << std::endl;
+        if (ensemble_size > 0) {
+            run_ensemble(ensemble_size, ensemble_ngroups, wall_start);
+        } else {
+            run_incflo(wall_start);
+        }
     }
     amrex::Finalize();
 }
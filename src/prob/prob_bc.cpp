@@ -309,6 +309,14 @@ void incflo::prob_set_diffusion_robinBCs (Orientation const& ori, Box const& bx,
     }
 }
 
+// The mixed BCs of probtypes 1100-1102 are fixed in time. Return true here for
+// a probtype whose masks or Robin coefficients vary in time, so that they are
+// rebuilt whenever the time changes instead of only after a regrid.
+bool incflo::prob_mixedBC_is_time_dependent () const
+{
+    return false;
+}
+
 void incflo::prob_set_inflow_velocity (int /*grid_id*/, Orientation ori, Box const& bx,
                                        Array4<Real> const& vel, int lev, Real /*time*/)
 {
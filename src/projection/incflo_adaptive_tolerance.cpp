@@ -0,0 +1,152 @@
+#include <incflo.H>
+
+#include <algorithm>
+
+using namespace amrex;
+
+//
+// Adaptive relative tolerance of the projections.
+//
+// A projection changes the velocity by du. Solving to a relative tolerance
+// rtol leaves an error of about rtol*du in the velocity, which only has to
+// be small compared to the truncation error of the second order scheme,
+// estimated as
+//
+//     tau = (dx/L)^2 * U
+//
+// with dx the smallest cell size on the finest level, L the smallest extent
+// of the domain and U the velocity scale. The tolerance is therefore
+//
+//     rtol = factor * tau / du
+//
+// clamped to [mg_rtol, max_rtol]. Without an estimate of du (e.g. in the
+// initial projection, where there is no pressure gradient yet) the fixed
+// mg_rtol is used.
+//
+namespace {
+
+Real adapted_rtol (Real factor, Real min_rtol, Real max_rtol,
+                   Geometry const& fine_geom, Geometry const& crse_geom,
+                   Real umax, Real du)
+{
+    if (du <= Real(0.0)) { return min_rtol; }
+
+    Real dx = fine_geom.CellSize(0);
+    Real len = crse_geom.ProbLength(0);
+    for (int idim = 1; idim < AMREX_SPACEDIM; ++idim) {
+        dx = std::min(dx, fine_geom.CellSize(idim));
+        len = std::min(len, crse_geom.ProbLength(idim));
+    }
+
+    Real const tau = (dx/len) * (dx/len) * umax;
+    return std::clamp(factor * tau / du, min_rtol, std::max(min_rtol, max_rtol));
+}
+
+}
+
+//
+// MAC projection: du is the velocity change that cancels the divergence of
+// the predicted face velocities, dx*|div(umac)|, and U = |umac|
+//
+Real
+incflo::mac_projection_rtol (Vector<Array<MultiFab*,AMREX_SPACEDIM> > const& umac) const
+{
+    if (!m_mac_adaptive_tol.enabled) { return m_mac_mg_rtol; }
+
+    BL_PROFILE("incflo::mac_projection_rtol()");
+
+    // umax and max of dx*|div(umac)| over all levels
+    Array<Real,2> r{0.0, 0.0};
+    for (int lev = 0; lev <= finest_level; ++lev)
+    {
+        const auto dxinv = geom[lev].InvCellSizeArray();
+        Real const dx = amrex::min(AMREX_D_DECL(geom[lev].CellSize(0),
+                                                geom[lev].CellSize(1),
+                                                geom[lev].CellSize(2)));
+
+        AMREX_D_TERM(auto const& u = umac[lev][0]->const_arrays();,
+                     auto const& v = umac[lev][1]->const_arrays();,
+                     auto const& w = umac[lev][2]->const_arrays(););
+#ifdef AMREX_USE_EB
+        // Covered faces hold a large dummy value
+        auto const& flag = EBFactory(lev).getMultiEBCellFlagFab().const_arrays();
+#endif
+
+        ReduceOps<ReduceOpMax, ReduceOpMax> reduce_op;
+        ReduceData<Real, Real> reduce_data(reduce_op);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
+
+        reduce_op.eval(m_leveldata[lev]->velocity, IntVect(0), reduce_data,
+        [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept -> ReduceTuple
+        {
+#ifdef AMREX_USE_EB
+            if (flag[box_no](i,j,k).isCovered()) { return { Real(0.0), Real(0.0) }; }
+#endif
+            Real const umax = amrex::max(AMREX_D_DECL(amrex::Math::abs(u[box_no](i,j,k)),
+                                                      amrex::Math::abs(v[box_no](i,j,k)),
+                                                      amrex::Math::abs(w[box_no](i,j,k))));
+            Real const divu = AMREX_D_TERM( (u[box_no](i+1,j,k) - u[box_no](i,j,k)) * dxinv[0],
+                                          + (v[box_no](i,j+1,k) - v[box_no](i,j,k)) * dxinv[1],
+                                          + (w[box_no](i,j,k+1) - w[box_no](i,j,k)) * dxinv[2]);
+            return { umax, dx * amrex::Math::abs(divu) };
+        });
+
+        auto hv = reduce_data.value(reduce_op);
+        r[0] = amrex::max(r[0], amrex::get<0>(hv));
+        r[1] = amrex::max(r[1], amrex::get<1>(hv));
+    }
+    ParallelAllReduce::Max(r.data(), 2, ParallelContext::CommunicatorSub());
+
+    return adapted_rtol(m_mac_adaptive_tol.factor, m_mac_mg_rtol, m_mac_adaptive_tol.max_rtol,
+                        Geom(finest_level), Geom(0), r[0], r[1]);
+}
+
+//
+// Nodal projection: du is the velocity change due to the pressure gradient,
+// scaling_factor*|grad p|/rho, and U = |u^n|
+//
+Real
+incflo::nodal_projection_rtol (Vector<MultiFab const*> const& density, Real scaling_factor) const
+{
+    if (!m_nodal_adaptive_tol.enabled) { return m_nodal_mg_rtol; }
+
+    BL_PROFILE("incflo::nodal_projection_rtol()");
+
+    // umax and max of scaling_factor*|grad p|/rho over all levels
+    Array<Real,2> r{0.0, 0.0};
+    for (int lev = 0; lev <= finest_level; ++lev)
+    {
+        auto const& ld = *m_leveldata[lev];
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            r[0] = amrex::max(r[0], ld.velocity_o.norm0(idim, 0, true));
+        }
+
+        auto const& gp = ld.gp.const_arrays();
+        auto const& rho = density[lev]->const_arrays();
+#ifdef AMREX_USE_EB
+        auto const& flag = EBFactory(lev).getMultiEBCellFlagFab().const_arrays();
+#endif
+
+        ReduceOps<ReduceOpMax> reduce_op;
+        ReduceData<Real> reduce_data(reduce_op);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
+
+        reduce_op.eval(ld.gp, IntVect(0), reduce_data,
+        [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept -> ReduceTuple
+        {
+#ifdef AMREX_USE_EB
+            if (flag[box_no](i,j,k).isCovered()) { return { Real(0.0) }; }
+#endif
+            Real const g = std::sqrt(AMREX_D_TERM( gp[box_no](i,j,k,0)*gp[box_no](i,j,k,0),
+                                                 + gp[box_no](i,j,k,1)*gp[box_no](i,j,k,1),
+                                                 + gp[box_no](i,j,k,2)*gp[box_no](i,j,k,2)));
+            return { g / rho[box_no](i,j,k) };
+        });
+        Real const gpmax = amrex::get<0>(reduce_data.value(reduce_op));
+        r[1] = amrex::max(r[1], scaling_factor * gpmax);
+    }
+    ParallelAllReduce::Max(r.data(), 2, ParallelContext::CommunicatorSub());
+
+    return adapted_rtol(m_nodal_adaptive_tol.factor, m_nodal_mg_rtol, m_nodal_adaptive_tol.max_rtol,
+                        Geom(finest_level), Geom(0), r[0], r[1]);
+}
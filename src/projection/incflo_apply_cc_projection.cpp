@@ -177,6 +177,86 @@ average_mac_to_ccvel (const Array<MultiFab*,AMREX_SPACEDIM>& fc, MultiFab& cc)
         }
 }
 
+#ifdef AMREX_USE_EB
+//
+// EB version of average_mac_to_ccvel: in cut cells each component is the
+// average of the values on the two faces weighted by their area fractions,
+// so that covered faces do not contribute. Covered cells are set to zero.
+//
+void
+eb_average_mac_to_ccvel (const Array<MultiFab const*,AMREX_SPACEDIM>& fc, MultiFab& cc,
+                         EBFArrayBoxFactory const& ebfact)
+{
+        AMREX_ASSERT(cc.nComp() == AMREX_SPACEDIM);
+
+        auto const& flags = ebfact.getMultiEBCellFlagFab();
+        auto const& areafrac = ebfact.getAreaFrac();
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(cc,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        {
+            const Box& bx = mfi.tilebox();
+            FabType const typ = flags[mfi].getType(bx);
+
+            AMREX_D_TERM(Array4<Real const> const& fxarr = fc[0]->const_array(mfi);,
+                         Array4<Real const> const& fyarr = fc[1]->const_array(mfi);,
+                         Array4<Real const> const& fzarr = fc[2]->const_array(mfi););
+            Array4<Real> const& ccarr = cc.array(mfi);
+
+            if (typ == FabType::covered)
+            {
+                amrex::ParallelFor(bx, AMREX_SPACEDIM,
+                [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
+                {
+                    ccarr(i,j,k,n) = Real(0.0);
+                });
+            }
+            else if (typ == FabType::regular)
+            {
+                amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                {
+                    AMREX_D_TERM(ccarr(i,j,k,0) = Real(0.5) * (fxarr(i,j,k) + fxarr(i+1,j,k));,
+                                 ccarr(i,j,k,1) = Real(0.5) * (fyarr(i,j,k) + fyarr(i,j+1,k));,
+                                 ccarr(i,j,k,2) = Real(0.5) * (fzarr(i,j,k) + fzarr(i,j,k+1)););
+                });
+            }
+            else
+            {
+                Array4<EBCellFlag const> const& flag = flags.const_array(mfi);
+                AMREX_D_TERM(Array4<Real const> const& apx = areafrac[0]->const_array(mfi);,
+                             Array4<Real const> const& apy = areafrac[1]->const_array(mfi);,
+                             Array4<Real const> const& apz = areafrac[2]->const_array(mfi););
+
+                amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+                {
+                    if (flag(i,j,k).isCovered()) {
+                        AMREX_D_TERM(ccarr(i,j,k,0) = Real(0.0);,
+                                     ccarr(i,j,k,1) = Real(0.0);,
+                                     ccarr(i,j,k,2) = Real(0.0););
+                        return;
+                    }
+
+                    Real a = apx(i,j,k) + apx(i+1,j,k);
+                    ccarr(i,j,k,0) = (a > Real(0.0))
+                        ? (apx(i,j,k)*fxarr(i,j,k) + apx(i+1,j,k)*fxarr(i+1,j,k)) / a : Real(0.0);
+#if (AMREX_SPACEDIM >= 2)
+                    a = apy(i,j,k) + apy(i,j+1,k);
+                    ccarr(i,j,k,1) = (a > Real(0.0))
+                        ? (apy(i,j,k)*fyarr(i,j,k) + apy(i,j+1,k)*fyarr(i,j+1,k)) / a : Real(0.0);
+#endif
+#if (AMREX_SPACEDIM == 3)
+                    a = apz(i,j,k) + apz(i,j,k+1);
+                    ccarr(i,j,k,2) = (a > Real(0.0))
+                        ? (apz(i,j,k)*fzarr(i,j,k) + apz(i,j,k+1)*fzarr(i,j,k+1)) / a : Real(0.0);
+#endif
+                });
+            }
+        }
+}
+#endif
+
 //
 // Computes the following decomposition:
 //
@@ -294,8 +374,7 @@ void incflo::ApplyCCProjection (Vector<MultiFab const*> density,
     // Initialize (or redefine the beta in) the MacProjector
     if (macproj->needInitialization())
     {
-        LPInfo lp_info;
-        lp_info.setMaxCoarseningLevel(m_mac_mg_max_coarsening_level);
+        LPInfo const lp_info = mac_lp_info();
 #ifndef AMREX_USE_EB
         if (m_constant_density) {
             Vector<BoxArray> ba;
@@ -359,6 +438,15 @@ void incflo::ApplyCCProjection (Vector<MultiFab const*> density,
 
     macproj->setUMAC(mac_vec);
 
+#ifdef AMREX_USE_EB
+    if (m_eb_flow.enabled) {
+       for (int lev=0; lev <= finest_level; ++lev)
+       {
+          macproj->setEBInflowVelocity(lev, *get_velocity_eb()[lev]);
+       }
+    }
+#endif
+
     if (m_verbose > 2) amrex::Print() << "CC Projection:\n";
     //
     // Perform MAC projection:  - del dot (dt/rho) grad phi = div(U)
@@ -392,7 +480,7 @@ void incflo::ApplyCCProjection (Vector<MultiFab const*> density,
     for (int lev=0; lev <= finest_level; ++lev)
     {
 #ifdef AMREX_USE_EB
-        amrex::Abort("Haven't written mac_to_ccvel for EB");
+        eb_average_mac_to_ccvel(GetArrOfConstPtrs(m_fluxes[lev]), *cc_gphi[lev], EBFactory(lev));
 #else
         average_mac_to_ccvel(GetArrOfPtrs(m_fluxes[lev]),*cc_gphi[lev]);
 #endif
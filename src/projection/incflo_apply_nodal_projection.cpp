@@ -3,6 +3,7 @@
 #include <hydro_utils.H>
 #include <incflo.H>
 #include <prob_bc.H>
+#include <cmath>
 #include <memory>
 
 using namespace amrex;
@@ -120,12 +121,6 @@ void incflo::ApplyNodalProjection (Vector<MultiFab const*> const& density,
         }
     }
 
-    // Perform projection
-    std::unique_ptr<Hydro::NodalProjector> nodal_projector;
-
-    auto bclo = get_projection_bc(Orientation::low);
-    auto bchi = get_projection_bc(Orientation::high);
-
     for (int lev = 0; lev <= finest_level; ++lev) {
 #ifdef AMREX_USE_EB
         if (m_eb_flow.enabled) {
@@ -178,45 +173,136 @@ void incflo::ApplyNodalProjection (Vector<MultiFab const*> const& density,
         HydroUtils::enforceInOutSolvability(vel_vec, get_velocity_bcrec().data(), geom, true);
     }
 
-    LPInfo info;
-    info.setMaxCoarseningLevel(m_nodal_mg_max_coarsening_level);
+    // With constant density the projector solves for scaling_factor*phi
+    Real const phi_scale = (m_constant_density) ? Real(1.0) / scaling_factor : Real(1.0);
 
-    if (m_constant_density)
-    {
-        Real constant_sigma = scaling_factor / m_ro_0;
-        nodal_projector = std::make_unique<Hydro::NodalProjector>(vel, constant_sigma,
-                                         Geom(0,finest_level), info);
-    } else
+    // phi and its gradient
+    Vector<MultiFab*> phi;
+    Vector<MultiFab*> gradphi;
+
+    if (m_nodal_solver == "fft" && fft_projection_available("nodal_proj"))
     {
-        nodal_projector = std::make_unique<Hydro::NodalProjector>(vel, GetVecOfConstPtrs(sigma),
-                                         Geom(0,finest_level), info);
-    }
-    nodal_projector->setDomainBC(bclo, bchi);
+        // Direct solve with the sigma = 1/ro_0 of the constant density projector
+        MultiFab& phi_fft = m_scratch.get(0, "fft_nodal_phi",
+                                          amrex::convert(grids[0], IntVect::TheNodeVector()),
+                                          dmap[0], 1, 0, *m_factory[0]);
+        MultiFab& gradphi_fft = m_scratch.get(0, "fft_nodal_gradphi", grids[0], dmap[0],
+                                              AMREX_SPACEDIM, 0, *m_factory[0]);
+        {
+            Telemetry::Timer timer(m_telemetry, Telemetry::Phase::NodalProj);
+            fft_nodal_projection(*vel[0], Real(1.0)/m_ro_0, phi_fft, gradphi_fft);
+        }
+        m_telemetry.record_solve("nodal_proj_fft", 0, Real(0.0));
 
-#ifdef AMREX_USE_EB
-    if (m_eb_flow.enabled) {
-       for(int lev = 0; lev <= finest_level; ++lev) {
-          nodal_projector->getLinOp().setEBInflowVelocity(lev, *get_velocity_eb()[lev]);
-       }
+        phi.push_back(&phi_fft);
+        gradphi.push_back(&gradphi_fft);
     }
-
-    if(m_has_mixedBC)
+    else
     {
-        // We use an overset mask to effectively apply the mixed BC
-        for(int lev = 0; lev <= finest_level; ++lev)
+        // The projector (and with it the operator hierarchy, the coarse-grid
+        // operators and the bottom solver) is kept until the grids change; it is
+        // released in MakeNewLevelFromCoarse, RemakeLevel and ClearLevel.
+        //
+        // With constant density it is built with sigma = 1/ro_0 and reused as is:
+        // the right hand side div(vel) does not depend on sigma, so solving with
+        // sigma/scaling_factor gives the same velocity and scaling_factor*phi,
+        // which is scaled back below. With variable density only sigma is reset.
+        // A time dependent mixed BC changes the overset mask the operator was
+        // built with, so the projector is then rebuilt for every projection.
+        bool const mixedBC_changes = m_has_mixedBC && prob_mixedBC_is_time_dependent();
+        if (!m_nodal_projector || m_nodal_proj_vel != vel || mixedBC_changes)
         {
-            const auto mask = make_nodalBC_mask(lev);
-            nodal_projector->getLinOp().setOversetMask(lev, mask);
+            LPInfo const info = nodal_lp_info();
+
+            if (m_constant_density)
+            {
+                Real constant_sigma = Real(1.0) / m_ro_0;
+                m_nodal_projector = std::make_unique<Hydro::NodalProjector>(vel, constant_sigma,
+                                                     Geom(0,finest_level), info);
+            } else
+            {
+                m_nodal_projector = std::make_unique<Hydro::NodalProjector>(vel, GetVecOfConstPtrs(sigma),
+                                                     Geom(0,finest_level), info);
+            }
+            m_nodal_projector->setDomainBC(get_projection_bc(Orientation::low),
+                                           get_projection_bc(Orientation::high));
+            m_nodal_proj_vel = vel;
+
+#ifdef AMREX_USE_EB
+            if(m_has_mixedBC)
+            {
+                // We use an overset mask to effectively apply the mixed BC
+                for(int lev = 0; lev <= finest_level; ++lev)
+                {
+                    m_nodal_projector->getLinOp().setOversetMask(lev, get_nodalBC_mask(lev));
+                }
+            }
+#endif
+        }
+        else if (!m_constant_density)
+        {
+            for (int lev = 0; lev <= finest_level; ++lev) {
+                m_nodal_projector->getLinOp().setSigma(lev, sigma[lev]);
+            }
         }
-    }
 
+#ifdef AMREX_USE_EB
+        if (m_eb_flow.enabled) {
+           for(int lev = 0; lev <= finest_level; ++lev) {
+              m_nodal_projector->getLinOp().setEBInflowVelocity(lev, *get_velocity_eb()[lev]);
+           }
+        }
 #endif
 
-    nodal_projector->project(m_nodal_mg_rtol, m_nodal_mg_atol);
+        // In the non-incremental form phi is the new pressure, so the pressure of
+        // the previous step is a good initial guess and the solver only has to
+        // converge the change. The incremental form solves for a correction,
+        // which starts from zero.
+        bool const warm_start = m_nodal_warm_start && !incremental;
+        for (int lev = 0; lev <= finest_level; ++lev) {
+            MultiFab& phi_lev = *m_nodal_projector->getPhi()[lev];
+            phi_lev.setVal(0.0);
+            if (warm_start) {
+                MultiFab::Saxpy(phi_lev, Real(1.0)/phi_scale, m_leveldata[lev]->p_nd, 0, 0, 1, 0);
+            }
+        }
+
+        Real const nodal_rtol = nodal_projection_rtol(density, scaling_factor);
+        {
+            Telemetry::Timer timer(m_telemetry, Telemetry::Phase::NodalProj);
+            m_nodal_projector->project(nodal_rtol, m_nodal_mg_atol);
+        }
+
+        auto& mlmg = m_nodal_projector->getMLMG();
+        m_telemetry.record_solve("nodal_proj", mlmg.getNumIters(), mlmg.getFinalResidual(),
+                                 m_nodal_adaptive_tol.enabled ? nodal_rtol : Real(-1.0));
+        if (m_nodal_adaptive_tol.enabled && m_verbose > 0) {
+            amrex::Print() << "Nodal projection: rtol = " << nodal_rtol << " (adaptive), "
+                           << mlmg.getNumIters() << " iterations" << std::endl;
+        }
+
+        if (warm_start && m_verbose > 0)
+        {
+            // A cold start begins with the residual equal to the right hand side.
+            // Estimate the iterations it would have needed from the convergence
+            // rate of this solve.
+            int const niters = mlmg.getNumIters();
+            Real const rhs_norm = mlmg.getInitRHS();
+            Real const res_init = mlmg.getInitResidual();
+            Real const res_final = mlmg.getFinalResidual();
 
-    // Get phi and fluxes
-    auto phi = nodal_projector->getPhi();
-    auto gradphi = nodal_projector->getGradPhi();
+            amrex::Print() << "Nodal projection (warm start): " << niters << " iterations";
+            if (niters > 0 && res_final > 0.0 && res_final < res_init && res_init < rhs_norm) {
+                Real const rate = std::log(res_init/res_final) / Real(niters);
+                int const saved = static_cast<int>(std::log(rhs_norm/res_init) / rate + Real(0.5));
+                amrex::Print() << ", about " << saved << " saved";
+            }
+            amrex::Print() << std::endl;
+        }
+
+        phi = m_nodal_projector->getPhi();
+        gradphi = m_nodal_projector->getGradPhi();
+    }
 
     for(int lev = 0; lev <= finest_level; lev++)
     {
@@ -235,21 +321,21 @@ void incflo::ApplyNodalProjection (Vector<MultiFab const*> const& density,
                 ParallelFor(tbx, AMREX_SPACEDIM,
                 [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
                 {
-                    gp_lev(i,j,k,n) += gp_proj(i,j,k,n);
+                    gp_lev(i,j,k,n) += phi_scale * gp_proj(i,j,k,n);
                 });
                 ParallelFor(nbx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
                 {
-                    p_lev (i,j,k) += p_proj(i,j,k);
+                    p_lev (i,j,k) += phi_scale * p_proj(i,j,k);
                 });
             } else {
                 ParallelFor(tbx, AMREX_SPACEDIM,
                 [=] AMREX_GPU_DEVICE (int i, int j, int k, int n) noexcept
                 {
-                    gp_lev(i,j,k,n) = gp_proj(i,j,k,n);
+                    gp_lev(i,j,k,n) = phi_scale * gp_proj(i,j,k,n);
                 });
                 ParallelFor(nbx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
                 {
-                    p_lev(i,j,k) = p_proj(i,j,k);
+                    p_lev(i,j,k) = phi_scale * p_proj(i,j,k);
                 });
             }
         }
@@ -0,0 +1,287 @@
+#include <incflo.H>
+
+using namespace amrex;
+
+//
+// Direct spectral solves for the MAC and nodal projections.
+//
+// On a single level, fully periodic, constant density domain without
+// embedded boundaries the projection operators have constant coefficients,
+// so they are diagonalized by the discrete Fourier transform. We transform
+// the divergence with the AMReX FFT (which redistributes the data into
+// slabs or pencils over MPI as needed), divide by the symbol of the same
+// discrete Laplacian MLMG would invert and transform back. The result
+// matches the MLMG solution to round-off, up to the arbitrary constant.
+//
+
+// Returns true if the FFT solver can be used for the projection named
+// solver_name ("mac_proj" or "nodal_proj"); otherwise says why, once, and
+// returns false so that the caller falls back to MLMG.
+bool
+incflo::fft_projection_available (std::string const& solver_name)
+{
+    std::string reason;
+#ifndef AMREX_USE_FFT
+    reason = "incflo was built without FFT support (USE_FFT = TRUE or INCFLO_FFT = ON)";
+#else
+    if (finest_level > 0) {
+        reason = "there is more than one level";
+    } else if (!geom[0].isAllPeriodic()) {
+        reason = "the domain is not periodic in all directions";
+    } else if (!m_constant_density) {
+        reason = "the density is not constant";
+    }
+#ifdef AMREX_USE_EB
+    else if (!EBFactory(0).isAllRegular() || m_eb_flow.enabled) {
+        reason = "there are embedded boundaries";
+    }
+#endif
+#endif
+
+    if (reason.empty()) { return true; }
+
+    if (m_fft_fallback_warned.count(solver_name) == 0) {
+        amrex::Print() << "WARNING: " << solver_name << ".solver = fft cannot be used because "
+                       << reason << "; using MLMG instead" << std::endl;
+        m_fft_fallback_warned.insert(solver_name);
+    }
+    return false;
+}
+
+#ifdef AMREX_USE_FFT
+
+// Solve L(phi) = rhs where the symbol of L is given by laplacian(i,j,k), the
+// eigenvalue of the discrete operator for the Fourier mode (i,j,k). The
+// constant mode, for which the symbol vanishes, is set to zero.
+template <typename F>
+void
+incflo::fft_solve (MultiFab const& rhs, MultiFab& soln, F const& laplacian)
+{
+    if (!m_fft_r2c) {
+        m_fft_r2c = std::make_unique<FFT::R2C<Real,FFT::Direction::both> >(geom[0].Domain());
+    }
+
+    // The transforms are not normalized
+    Real const scale = Real(1.0) / geom[0].Domain().d_numPts();
+
+    m_fft_r2c->forwardThenBackward(rhs, soln,
+        [=] AMREX_GPU_DEVICE (int i, int j, int k, GpuComplex<Real>& spectral_data)
+        {
+            Real const lap = laplacian(i,j,k);
+            if (lap != Real(0.0)) {
+                spectral_data *= scale / lap;
+            } else {
+                spectral_data = GpuComplex<Real>(Real(0.0), Real(0.0));
+            }
+        });
+}
+
+//
+// Nodal projection: vel = vel - sigma grad(phi) with div(vel) = 0, for the
+// cell-centered velocity vel and the nodal phi. The divergence, gradient and
+// operator (the Q1 finite element stencil) are those of MLNodeLaplacian.
+// On the periodic domain node i coincides with node i+n, so the n nodes in
+// each direction are stored as the n cells of grids[0] for the transform.
+//
+void
+incflo::fft_nodal_projection (MultiFab& vel, Real sigma, MultiFab& phi, MultiFab& gradphi)
+{
+    BL_PROFILE("incflo::fft_nodal_projection()");
+
+    Geometry const& gm = geom[0];
+    auto const dxinv = gm.InvCellSizeArray();
+
+    vel.FillBoundary(0, AMREX_SPACEDIM, IntVect(1), gm.periodicity());
+
+    MultiFab& rhs  = m_scratch.get(0, "fft_rhs" , grids[0], dmap[0], 1, 0, *m_factory[0]);
+    MultiFab& soln = m_scratch.get(0, "fft_soln", grids[0], dmap[0], 1, 1, *m_factory[0]);
+
+    // Nodal divergence of the cell-centered velocity
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(rhs,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        Box const& bx = mfi.tilebox();
+        Array4<Real> const& r = rhs.array(mfi);
+        Array4<Real const> const& u = vel.const_array(mfi);
+        ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+        {
+#if (AMREX_SPACEDIM == 3)
+            r(i,j,k) = Real(0.25)*dxinv[0]*( u(i  ,j-1,k-1,0) + u(i  ,j,k-1,0) + u(i  ,j-1,k,0) + u(i  ,j,k,0)
+                                            -u(i-1,j-1,k-1,0) - u(i-1,j,k-1,0) - u(i-1,j-1,k,0) - u(i-1,j,k,0))
+                     + Real(0.25)*dxinv[1]*( u(i-1,j  ,k-1,1) + u(i,j  ,k-1,1) + u(i-1,j  ,k,1) + u(i,j  ,k,1)
+                                            -u(i-1,j-1,k-1,1) - u(i,j-1,k-1,1) - u(i-1,j-1,k,1) - u(i,j-1,k,1))
+                     + Real(0.25)*dxinv[2]*( u(i-1,j-1,k  ,2) + u(i,j-1,k  ,2) + u(i-1,j,k  ,2) + u(i,j,k  ,2)
+                                            -u(i-1,j-1,k-1,2) - u(i,j-1,k-1,2) - u(i-1,j,k-1,2) - u(i,j,k-1,2));
+#else
+            r(i,j,k) = Real(0.5)*dxinv[0]*( u(i  ,j-1,k,0) + u(i  ,j,k,0)
+                                           -u(i-1,j-1,k,0) - u(i-1,j,k,0))
+                     + Real(0.5)*dxinv[1]*( u(i-1,j  ,k,1) + u(i,j  ,k,1)
+                                           -u(i-1,j-1,k,1) - u(i,j-1,k,1));
+#endif
+        });
+    }
+
+    Box const& domain = gm.Domain();
+    GpuArray<Real,AMREX_SPACEDIM> theta;
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        theta[idim] = Real(2.0) * Math::pi<Real>() / Real(domain.length(idim));
+    }
+
+    // Symbol of the Q1 finite element Laplacian: the 1D stiffness
+    // 2(cos(theta)-1)/dx^2 in one direction times the 1D mass (2+cos(theta))/3
+    // in the others
+    fft_solve(rhs, soln, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+    {
+        amrex::ignore_unused(j,k);
+        AMREX_D_TERM(Real const c0 = std::cos(theta[0]*Real(i));,
+                     Real const c1 = std::cos(theta[1]*Real(j));,
+                     Real const c2 = std::cos(theta[2]*Real(k)));
+        AMREX_D_TERM(Real const k0 = Real(2.0)*(c0-Real(1.0))*dxinv[0]*dxinv[0];,
+                     Real const k1 = Real(2.0)*(c1-Real(1.0))*dxinv[1]*dxinv[1];,
+                     Real const k2 = Real(2.0)*(c2-Real(1.0))*dxinv[2]*dxinv[2]);
+        AMREX_D_TERM(Real const m0 = (Real(2.0)+c0)/Real(3.0);,
+                     Real const m1 = (Real(2.0)+c1)/Real(3.0);,
+                     Real const m2 = (Real(2.0)+c2)/Real(3.0));
+#if (AMREX_SPACEDIM == 3)
+        return sigma*(k0*m1*m2 + m0*k1*m2 + m0*m1*k2);
+#else
+        return sigma*(k0*m1 + m0*k1);
+#endif
+    });
+
+    // The nodes on the high side of each box are the cells of its neighbor
+    soln.FillBoundary(gm.periodicity());
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(phi,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        Box const& nbx = mfi.tilebox();
+        Array4<Real> const& p = phi.array(mfi);
+        Array4<Real const> const& s = soln.const_array(mfi);
+        ParallelFor(nbx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+        {
+            p(i,j,k) = s(i,j,k);
+        });
+    }
+
+    // Cell-centered gradient of phi and the velocity update
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(gradphi,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        Box const& bx = mfi.tilebox();
+        Array4<Real> const& gphi = gradphi.array(mfi);
+        Array4<Real> const& u = vel.array(mfi);
+        Array4<Real const> const& p = phi.const_array(mfi);
+        ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+        {
+#if (AMREX_SPACEDIM == 3)
+            gphi(i,j,k,0) = Real(0.25)*dxinv[0]*( p(i+1,j,k  ) + p(i+1,j+1,k  ) + p(i+1,j,k+1) + p(i+1,j+1,k+1)
+                                                 -p(i  ,j,k  ) - p(i  ,j+1,k  ) - p(i  ,j,k+1) - p(i  ,j+1,k+1));
+            gphi(i,j,k,1) = Real(0.25)*dxinv[1]*( p(i,j+1,k  ) + p(i+1,j+1,k  ) + p(i,j+1,k+1) + p(i+1,j+1,k+1)
+                                                 -p(i,j  ,k  ) - p(i+1,j  ,k  ) - p(i,j  ,k+1) - p(i+1,j  ,k+1));
+            gphi(i,j,k,2) = Real(0.25)*dxinv[2]*( p(i,j  ,k+1) + p(i+1,j  ,k+1) + p(i,j+1,k+1) + p(i+1,j+1,k+1)
+                                                 -p(i,j  ,k  ) - p(i+1,j  ,k  ) - p(i,j+1,k  ) - p(i+1,j+1,k  ));
+#else
+            gphi(i,j,k,0) = Real(0.5)*dxinv[0]*( p(i+1,j,k) + p(i+1,j+1,k) - p(i,j,k) - p(i,j+1,k));
+            gphi(i,j,k,1) = Real(0.5)*dxinv[1]*( p(i,j+1,k) + p(i+1,j+1,k) - p(i,j,k) - p(i+1,j,k));
+#endif
+            AMREX_D_TERM(u(i,j,k,0) -= sigma*gphi(i,j,k,0);,
+                         u(i,j,k,1) -= sigma*gphi(i,j,k,1);,
+                         u(i,j,k,2) -= sigma*gphi(i,j,k,2););
+        });
+    }
+}
+
+//
+// MAC projection: umac = umac - beta grad(phi) with div(umac) = 0, for the
+// face velocities umac and the cell-centered phi (with one ghost cell), with
+// the standard 5/7-point Laplacian of MLPoisson.
+//
+void
+incflo::fft_mac_projection (Array<MultiFab*,AMREX_SPACEDIM> const& umac, Real beta, MultiFab& phi)
+{
+    BL_PROFILE("incflo::fft_mac_projection()");
+
+    Geometry const& gm = geom[0];
+    auto const dxinv = gm.InvCellSizeArray();
+
+    MultiFab& rhs = m_scratch.get(0, "fft_rhs", grids[0], dmap[0], 1, 0, *m_factory[0]);
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(rhs,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        Box const& bx = mfi.tilebox();
+        Array4<Real> const& r = rhs.array(mfi);
+        AMREX_D_TERM(Array4<Real const> const& u = umac[0]->const_array(mfi);,
+                     Array4<Real const> const& v = umac[1]->const_array(mfi);,
+                     Array4<Real const> const& w = umac[2]->const_array(mfi););
+        ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+        {
+            r(i,j,k) = AMREX_D_TERM( dxinv[0]*(u(i+1,j,k) - u(i,j,k)),
+                                    + dxinv[1]*(v(i,j+1,k) - v(i,j,k)),
+                                    + dxinv[2]*(w(i,j,k+1) - w(i,j,k)));
+        });
+    }
+
+    Box const& domain = gm.Domain();
+    GpuArray<Real,AMREX_SPACEDIM> theta;
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        theta[idim] = Real(2.0) * Math::pi<Real>() / Real(domain.length(idim));
+    }
+
+    fft_solve(rhs, phi, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+    {
+        amrex::ignore_unused(j,k);
+        return beta * (AMREX_D_TERM(
+             Real(2.0)*(std::cos(theta[0]*Real(i))-Real(1.0))*dxinv[0]*dxinv[0],
+           + Real(2.0)*(std::cos(theta[1]*Real(j))-Real(1.0))*dxinv[1]*dxinv[1],
+           + Real(2.0)*(std::cos(theta[2]*Real(k))-Real(1.0))*dxinv[2]*dxinv[2]));
+    });
+
+    phi.FillBoundary(gm.periodicity());
+
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
+    {
+        IntVect const shift = IntVect::TheDimensionVector(idim);
+        Real const fac = beta*dxinv[idim];
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+        for (MFIter mfi(*umac[idim],TilingIfNotGPU()); mfi.isValid(); ++mfi)
+        {
+            Box const& fbx = mfi.tilebox();
+            Array4<Real> const& uface = umac[idim]->array(mfi);
+            Array4<Real const> const& p = phi.const_array(mfi);
+            ParallelFor(fbx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                IntVect const iv(AMREX_D_DECL(i,j,k));
+                uface(iv) -= fac*(p(iv) - p(iv-shift));
+            });
+        }
+    }
+}
+
+#else
+
+void
+incflo::fft_nodal_projection (MultiFab& /*vel*/, Real /*sigma*/, MultiFab& /*phi*/, MultiFab& /*gradphi*/)
+{
+    amrex::Abort("incflo::fft_nodal_projection: incflo was built without FFT support");
+}
+
+void
+incflo::fft_mac_projection (Array<MultiFab*,AMREX_SPACEDIM> const& /*umac*/, Real /*beta*/,
+                            MultiFab& /*phi*/)
+{
+    amrex::Abort("incflo::fft_mac_projection: incflo was built without FFT support");
+}
+
+#endif
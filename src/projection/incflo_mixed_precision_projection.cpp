@@ -0,0 +1,142 @@
+#include <incflo.H>
+#include <AMReX_MLMG.H>
+
+using namespace amrex;
+
+// Mixed precision is only worth it (and only possible) for the constant
+// coefficient MAC projection of a double precision build without EB
+bool
+incflo::use_mixed_precision_mac () const
+{
+#if defined(AMREX_USE_EB) || defined(AMREX_USE_FLOAT)
+    return false;
+#else
+    return m_mac_mixed_precision && m_constant_density && !m_has_mixedBC;
+#endif
+}
+
+// Release the operators; called whenever the grids change
+void
+incflo::reset_mixed_precision_mac ()
+{
+#if !defined(AMREX_USE_EB) && !defined(AMREX_USE_FLOAT)
+    m_mac_mp_linop.reset();
+    m_mac_mp_linop_f.reset();
+#endif
+}
+
+//
+// Iterative refinement for the MAC projection
+//
+//     beta lap(phi) = div(umac)
+//
+// The residual is computed in double precision and the correction is solved
+// for with MLMG in single precision, to the loose tolerance
+// m_mac_mixed_precision_rtol, so that the V-cycles (smoothing, restriction,
+// bottom solve) move half as many bytes. This is repeated until the residual
+// meets rtol / m_mac_mg_atol. The result is returned in phi (which
+// holds the initial guess on entry) and is then passed to the MacProjector as
+// the initial guess: it only has to check the residual and correct umac, and
+// guarantees the final accuracy even if the refinement stopped early.
+//
+void
+incflo::mixed_precision_mac_solve (Vector<Array<MultiFab*,AMREX_SPACEDIM> > const& umac,
+                                   Real beta, Real rtol, Vector<MultiFab*> const& phi)
+{
+#if defined(AMREX_USE_EB) || defined(AMREX_USE_FLOAT)
+    amrex::ignore_unused(umac, beta, rtol, phi);
+    amrex::Abort("incflo::mixed_precision_mac_solve: not available in this build");
+#else
+    BL_PROFILE("incflo::mixed_precision_mac_solve()");
+
+    int const nlevs = finest_level + 1;
+
+    if (!m_mac_mp_linop)
+    {
+        LPInfo const info = mac_lp_info();
+        m_mac_mp_linop = std::make_unique<MLPoisson>(Geom(0,finest_level), boxArray(0,finest_level),
+                                                     DistributionMap(0,finest_level), info);
+        m_mac_mp_linop_f = std::make_unique<MLPoissonT<SPMultiFab> >(Geom(0,finest_level), boxArray(0,finest_level),
+                                                                    DistributionMap(0,finest_level), info);
+        m_mac_mp_linop->setDomainBC(get_mac_projection_bc(Orientation::low),
+                                    get_mac_projection_bc(Orientation::high));
+        m_mac_mp_linop_f->setDomainBC(get_mac_projection_bc(Orientation::low),
+                                      get_mac_projection_bc(Orientation::high));
+        for (int lev = 0; lev < nlevs; ++lev) {
+            m_mac_mp_linop->setLevelBC(lev, nullptr);
+            m_mac_mp_linop_f->setLevelBC(lev, nullptr);
+        }
+    }
+
+    MLMG mlmg(*m_mac_mp_linop);
+    MLMGT<SPMultiFab> mlmg_f(*m_mac_mp_linop_f);
+    mlmg_f.setVerbose(0);
+
+    // rhs = div(umac)/beta, the residual and its single precision copies
+    Vector<MultiFab> rhs(nlevs), res(nlevs);
+    Vector<SPMultiFab> res_f(nlevs), cor_f(nlevs);
+    Real rhs_norm = 0.0;
+    for (int lev = 0; lev < nlevs; ++lev) {
+        rhs[lev].define(grids[lev], dmap[lev], 1, 0);
+        res[lev].define(grids[lev], dmap[lev], 1, 0);
+        res_f[lev].define(grids[lev], dmap[lev], 1, 0);
+        cor_f[lev].define(grids[lev], dmap[lev], 1, 1);
+
+        computeDivergence(rhs[lev], GetArrOfConstPtrs(umac[lev]), geom[lev]);
+        rhs[lev].mult(Real(1.0)/beta);
+        rhs_norm = std::max(rhs_norm, rhs[lev].norm0(0, 0, true));
+    }
+    ParallelAllReduce::Max(rhs_norm, ParallelContext::CommunicatorSub());
+
+    Real const res_target = std::max(m_mac_mg_atol/beta, rtol*rhs_norm);
+    float const inner_rtol = static_cast<float>(m_mac_mixed_precision_rtol);
+
+    int iter = 0;
+    int inner_iters = 0;
+    Real res_norm = 0.0;
+    for (; iter <= m_mac_mixed_precision_maxiter; ++iter)
+    {
+        // res = rhs - lap(phi), in double precision
+        mlmg.apply(GetVecOfPtrs(res), phi);
+        res_norm = 0.0;
+        for (int lev = 0; lev < nlevs; ++lev) {
+            MultiFab::Xpay(res[lev], Real(-1.0), rhs[lev], 0, 0, 1, 0);
+            res_norm = std::max(res_norm, res[lev].norm0(0, 0, true));
+        }
+        ParallelAllReduce::Max(res_norm, ParallelContext::CommunicatorSub());
+
+        if (res_norm <= res_target || iter == m_mac_mixed_precision_maxiter) { break; }
+
+        // Solve lap(cor) = res in single precision and correct phi
+        for (int lev = 0; lev < nlevs; ++lev) {
+            auto const& r  = res[lev].const_arrays();
+            auto const& rf = res_f[lev].arrays();
+            ParallelFor(res[lev], [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept
+            {
+                rf[box_no](i,j,k) = static_cast<float>(r[box_no](i,j,k));
+            });
+            cor_f[lev].setVal(0.0f);
+        }
+        Gpu::streamSynchronize();
+
+        mlmg_f.solve(GetVecOfPtrs(cor_f), GetVecOfConstPtrs(res_f), inner_rtol, 0.0f);
+        inner_iters += mlmg_f.getNumIters();
+
+        for (int lev = 0; lev < nlevs; ++lev) {
+            auto const& p  = phi[lev]->arrays();
+            auto const& cf = cor_f[lev].const_arrays();
+            ParallelFor(*phi[lev], [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept
+            {
+                p[box_no](i,j,k) += static_cast<Real>(cf[box_no](i,j,k));
+            });
+        }
+        Gpu::streamSynchronize();
+    }
+
+    if (m_verbose > 0) {
+        amrex::Print() << "MAC mixed precision: " << iter << " refinement steps, "
+                       << inner_iters << " single precision iterations, residual "
+                       << res_norm << " (target " << res_target << ")" << std::endl;
+    }
+#endif
+}
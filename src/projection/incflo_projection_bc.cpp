@@ -81,3 +81,47 @@ incflo::get_mac_projection_bc (Orientation::Side side) const noexcept
     }
     return r;
 }
+
+namespace {
+
+// At large rank counts the coarse MLMG levels have only a few cells per
+// rank, and the bottom solve is dominated by the latency of its reductions.
+// Agglomeration merges the small coarse grids, and consolidation moves the
+// coarse levels onto fewer ranks: at every coarsening level with grids
+// smaller than the consolidation grid size the number of ranks that own
+// grids is divided by the consolidation ratio.
+template <typename C>
+LPInfo make_lp_info (int max_coarsening_level, C const& c)
+{
+    LPInfo info;
+    info.setMaxCoarseningLevel(max_coarsening_level);
+    info.setAgglomeration(c.agglomeration);
+    info.setAgglomerationGridSize(c.agglomeration_grid_size);
+    info.setConsolidation(c.consolidation);
+    info.setConsolidationGridSize(c.consolidation_grid_size);
+    info.setConsolidationStrategy(c.consolidation_strategy);
+
+    if (c.bottom_ranks > 0) {
+        // Gather onto about bottom_ranks ranks at the first consolidated level
+        int const nprocs = ParallelContext::NProcsSub();
+        info.setConsolidation(true);
+        info.setConsolidationRatio(std::max(2, (nprocs + c.bottom_ranks - 1) / c.bottom_ranks));
+    } else {
+        info.setConsolidationRatio(c.consolidation_ratio);
+    }
+    return info;
+}
+
+}
+
+LPInfo
+incflo::mac_lp_info () const
+{
+    return make_lp_info(m_mac_mg_max_coarsening_level, m_mac_mg_coarsening);
+}
+
+LPInfo
+incflo::nodal_lp_info () const
+{
+    return make_lp_info(m_nodal_mg_max_coarsening_level, m_nodal_mg_coarsening);
+}
@@ -1,6 +1,8 @@
 #include <incflo.H>
 #include <incflo_derive_K.H>
 
+#include <type_traits>
+
 using namespace amrex;
 
 namespace {
@@ -12,39 +14,112 @@ amrex::Real expterm (amrex::Real nu) noexcept
                         : -std::expm1(-nu)/nu;
 }
 
+// The fluid model is a template parameter, so that each kernel is straight
+// line code without a branch on the model in every cell
+template <incflo::FluidModel Model>
 struct NonNewtonianViscosity
 {
-    incflo::FluidModel fluid_model;
     amrex::Real mu, n_flow, tau_0, eta_0, papa_reg;
 
     AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE
     amrex::Real operator() (amrex::Real sr) const noexcept {
-        switch (fluid_model)
-        {
-        case incflo::FluidModel::powerlaw:
-        {
+        if constexpr (Model == incflo::FluidModel::powerlaw) {
             return mu * std::pow(sr,n_flow-Real(1.0));
-        }
-        case incflo::FluidModel::Bingham:
-        {
+        } else if constexpr (Model == incflo::FluidModel::Bingham) {
             return mu + tau_0 * expterm(sr/papa_reg) / papa_reg;
+        } else if constexpr (Model == incflo::FluidModel::HerschelBulkley) {
+            return (mu*std::pow(sr,n_flow)+tau_0)*expterm(sr/papa_reg)/papa_reg;
+        } else if constexpr (Model == incflo::FluidModel::deSouzaMendesDutra) {
+            return (mu*std::pow(sr,n_flow)+tau_0)*expterm(sr*(eta_0/tau_0))*(eta_0/tau_0);
+        } else {
+            amrex::ignore_unused(sr);
+            return mu;
         }
-        case incflo::FluidModel::HerschelBulkley:
+    }
+};
+
+// Call f with the fluid model as a std::integral_constant
+template <typename F>
+void dispatch_fluid_model (incflo::FluidModel fluid_model, F const& f)
+{
+    using FM = incflo::FluidModel;
+    switch (fluid_model)
+    {
+    case FM::powerlaw:
+        f(std::integral_constant<FM, FM::powerlaw>{});
+        break;
+    case FM::Bingham:
+        f(std::integral_constant<FM, FM::Bingham>{});
+        break;
+    case FM::HerschelBulkley:
+        f(std::integral_constant<FM, FM::HerschelBulkley>{});
+        break;
+    case FM::deSouzaMendesDutra:
+        f(std::integral_constant<FM, FM::deSouzaMendesDutra>{});
+        break;
+    default:
+        f(std::integral_constant<FM, FM::Newtonian>{});
+    };
+}
+
+// Strain rate (component 0) and eta = viscosity(strain rate) (component 1)
+// on the cells of sr_eta grown by nghost, from one evaluation of the stencil
+template <incflo::FluidModel Model>
+void strainrate_and_eta_at_level (MultiFab& sr_eta, MultiFab const& vel,
+                                  Geometry const& lev_geom,
+#ifdef AMREX_USE_EB
+                                  FabArray<EBCellFlagFab> const& flags,
+#endif
+                                  NonNewtonianViscosity<Model> const& non_newtonian_viscosity,
+                                  int nghost)
+{
+    Real idx = Real(1.0) / lev_geom.CellSize(0);
+    Real idy = Real(1.0) / lev_geom.CellSize(1);
+#if (AMREX_SPACEDIM == 3)
+    Real idz = Real(1.0) / lev_geom.CellSize(2);
+#endif
+
+#ifdef _OPENMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    for (MFIter mfi(sr_eta,TilingIfNotGPU()); mfi.isValid(); ++mfi)
+    {
+        Box const& bx = mfi.growntilebox(nghost);
+        Array4<Real> const& sr_eta_arr = sr_eta.array(mfi);
+        Array4<Real const> const& vel_arr = vel.const_array(mfi);
+#ifdef AMREX_USE_EB
+        auto const& flag_fab = flags[mfi];
+        auto typ = flag_fab.getType(bx);
+        if (typ == FabType::covered)
         {
-            return (mu*std::pow(sr,n_flow)+tau_0)*expterm(sr/papa_reg)/papa_reg;
+            ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                sr_eta_arr(i,j,k,0) = Real(0.0);
+                sr_eta_arr(i,j,k,1) = Real(0.0);
+            });
         }
-        case incflo::FluidModel::deSouzaMendesDutra:
+        else if (typ == FabType::singlevalued)
         {
-            return (mu*std::pow(sr,n_flow)+tau_0)*expterm(sr*(eta_0/tau_0))*(eta_0/tau_0);
+            auto const& flag_arr = flag_fab.const_array();
+            ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                Real sr = incflo_strainrate_eb(i,j,k,AMREX_D_DECL(idx,idy,idz),vel_arr,flag_arr(i,j,k));
+                sr_eta_arr(i,j,k,0) = sr;
+                sr_eta_arr(i,j,k,1) = non_newtonian_viscosity(sr);
+            });
         }
-        default:
+        else
+#endif
         {
-            return mu;
+            ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
+            {
+                Real sr = incflo_strainrate(i,j,k,AMREX_D_DECL(idx,idy,idz),vel_arr);
+                sr_eta_arr(i,j,k,0) = sr;
+                sr_eta_arr(i,j,k,1) = non_newtonian_viscosity(sr);
+            });
         }
-        };
     }
-};
-
+}
 }
 
 void incflo::compute_viscosity (Vector<MultiFab*> const& vel_eta,
@@ -52,21 +127,19 @@ void incflo::compute_viscosity (Vector<MultiFab*> const& vel_eta,
                                 Vector<MultiFab*> const& vel,
                                 Real time, int nghost)
 {
+    if (m_fluid_model != FluidModel::Newtonian) { ++m_vel_eta_version; }
+
     for (int lev = 0; lev <= finest_level; ++lev)
     {
         compute_viscosity_at_level(lev, vel_eta[lev], rho[lev], vel[lev], geom[lev], time, nghost);
     }
 }
 
-#ifdef AMREX_USE_EB
 void incflo::compute_viscosity_at_level (int lev,
-#else
-void incflo::compute_viscosity_at_level (int /*lev*/,
-#endif
                                          MultiFab* vel_eta,
                                          MultiFab* /*rho*/,
                                          MultiFab* vel,
-                                         Geometry& lev_geom,
+                                         Geometry& /*lev_geom*/,
                                          Real /*time*/, int nghost)
 {
     if (m_fluid_model == FluidModel::Newtonian)
@@ -75,63 +148,61 @@ void incflo::compute_viscosity_at_level (int /*lev*/,
     }
     else
     {
-        NonNewtonianViscosity non_newtonian_viscosity;
-        non_newtonian_viscosity.fluid_model = m_fluid_model;
+        MultiFab::Copy(*vel_eta, strainrate_and_eta(lev, *vel, nghost), 1, 0, 1, nghost);
+    }
+}
+
+MultiFab const&
+incflo::strainrate_and_eta (int lev, MultiFab const& vel, int nghost)
+{
+    BL_PROFILE("incflo::strainrate_and_eta()");
+
+    AMREX_ALWAYS_ASSERT(nghost <= 1);
+
+    MultiFab& sr_eta = m_scratch.get(lev, "strainrate_eta", grids[lev], dmap[lev], 2, 1, Factory(lev));
+
+    // Which velocity state is this?
+    auto const& ld = *m_leveldata[lev];
+    int version = -1;
+    if (&vel == &ld.velocity) {
+        version = m_velocity_version.new_state;
+    } else if (&vel == &ld.velocity_o) {
+        version = m_velocity_version.old_state;
+    }
+
+    if (m_strainrate_tag.size() <= lev) { m_strainrate_tag.resize(lev+1); }
+    auto& tag = m_strainrate_tag[lev];
+    if (version >= 0 && tag.version == version && tag.nghost >= nghost) {
+        return sr_eta;
+    }
+
+    // The model is chosen once here rather than in every cell
+    dispatch_fluid_model(m_fluid_model, [&] (auto model)
+    {
+        NonNewtonianViscosity<decltype(model)::value> non_newtonian_viscosity;
         non_newtonian_viscosity.mu = m_mu;
         non_newtonian_viscosity.n_flow = m_n_0;
         non_newtonian_viscosity.tau_0 = m_tau_0;
         non_newtonian_viscosity.eta_0 = m_eta_0;
         non_newtonian_viscosity.papa_reg = m_papa_reg;
 
+        strainrate_and_eta_at_level(sr_eta, vel, Geom(lev),
 #ifdef AMREX_USE_EB
-        auto const& fact = EBFactory(lev);
-        auto const& flags = fact.getMultiEBCellFlagFab();
+                                    EBFactory(lev).getMultiEBCellFlagFab(),
 #endif
+                                    non_newtonian_viscosity, nghost);
+    });
 
-        Real idx = Real(1.0) / lev_geom.CellSize(0);
-        Real idy = Real(1.0) / lev_geom.CellSize(1);
-#if (AMREX_SPACEDIM == 3)
-        Real idz = Real(1.0) / lev_geom.CellSize(2);
-#endif
+    tag.version = version;
+    tag.nghost = nghost;
+    return sr_eta;
+}
 
-#ifdef _OPENMP
-#pragma omp parallel if (Gpu::notInLaunchRegion())
-#endif
-        for (MFIter mfi(*vel_eta,TilingIfNotGPU()); mfi.isValid(); ++mfi)
-        {
-                Box const& bx = mfi.growntilebox(nghost);
-                Array4<Real> const& eta_arr = vel_eta->array(mfi);
-                Array4<Real const> const& vel_arr = vel->const_array(mfi);
-#ifdef AMREX_USE_EB
-                auto const& flag_fab = flags[mfi];
-                auto typ = flag_fab.getType(bx);
-                if (typ == FabType::covered)
-                {
-                    ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
-                    {
-                        eta_arr(i,j,k) = Real(0.0);
-                    });
-                }
-                else if (typ == FabType::singlevalued)
-                {
-                    auto const& flag_arr = flag_fab.const_array();
-                    ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
-                    {
-                        Real sr = incflo_strainrate_eb(i,j,k,AMREX_D_DECL(idx,idy,idz),vel_arr,flag_arr(i,j,k));
-                        eta_arr(i,j,k) = non_newtonian_viscosity(sr);
-                    });
-                }
-                else
-#endif
-                {
-                    ParallelFor(bx, [=] AMREX_GPU_DEVICE (int i, int j, int k) noexcept
-                    {
-                        Real sr = incflo_strainrate(i,j,k,AMREX_D_DECL(idx,idy,idz),vel_arr);
-                        eta_arr(i,j,k) = non_newtonian_viscosity(sr);
-                    });
-                }
-        }
-    }
+void incflo::reset_strainrate_cache ()
+{
+    m_strainrate_tag.clear();
+    new_velocity_changed();
+    m_velocity_version.old_state = -1;
 }
 
 void incflo::compute_tracer_diff_coeff (Vector<MultiFab*> const& tra_eta, int nghost)
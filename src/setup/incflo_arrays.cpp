@@ -41,7 +41,9 @@ incflo::LevelData::LevelData (amrex::BoxArray const& ba,
         conv_density.define (ba, dm, 1                , 0, MFInfo(), fact);
         conv_tracer.define (ba, dm, my_incflo->m_ntrac, 0, MFInfo(), fact);
 
-        bool implicit_diffusion = my_incflo->m_diff_type == DiffusionType::Implicit;
+        // RKL2 applies the diffusion terms after the update, as the implicit solve does
+        bool implicit_diffusion = my_incflo->m_diff_type == DiffusionType::Implicit ||
+                                  my_incflo->m_diff_type == DiffusionType::RKL2;
         if (!implicit_diffusion || my_incflo->use_tensor_correction)
         {
             divtau.define  (ba, dm, AMREX_SPACEDIM, 0, MFInfo(), fact);
@@ -36,6 +36,7 @@ void incflo::ReadParameters ()
         pp.query("verbose", m_verbose);
 
         pp.query("steady_state_tol", m_steady_state_tol);
+        pp.query("steady_state_int", m_steady_state_int);
         pp.query("initial_iterations", m_initial_iterations);
         pp.query("do_initial_proj", m_do_initial_proj);
         pp.query("do_initial_pressure_proj", m_do_initial_pressure_proj);
@@ -101,8 +102,10 @@ void incflo::ReadParameters ()
             m_diff_type = DiffusionType::Crank_Nicolson;
         } else if (diffusion_type == 2) {
             m_diff_type = DiffusionType::Implicit;
+        } else if (diffusion_type == 3) {
+            m_diff_type = DiffusionType::RKL2;
         } else {
-            amrex::Abort("We currently require diffusion_type = 0 for explicit, 1 for Crank-Nicolson or 2 for implicit");
+            amrex::Abort("We currently require diffusion_type = 0 for explicit, 1 for Crank-Nicolson, 2 for implicit or 3 for RKL2");
         }
 
         // Default is true; should we use tensor solve instead of separate solves for each component?
@@ -117,6 +120,11 @@ void incflo::ReadParameters ()
             amrex::Abort("We cannot have use_tensor_correction be true and diffusion type not Implicit");
         }
 
+        pp.query("diffusion_guess_order", m_diffusion_guess.order);
+        if (m_diffusion_guess.order != 0 && m_diffusion_guess.order != 2 && m_diffusion_guess.order != 3) {
+            amrex::Abort("diffusion_guess_order must be 0 (provisional state), 2 or 3 (extrapolation)");
+        }
+
         if (m_advection_type == "MOL" && m_cfl > 0.5) {
             amrex::Abort("We currently require cfl <= 0.5 when using the MOL advection scheme");
         }
@@ -157,6 +165,27 @@ void incflo::ReadParameters ()
         for (int i = 0; i < m_ntrac; i++) {
             amrex::Print() << "Tracer diffusion coeff: " << i << ":" << m_mu_s[i] << std::endl;
         }
+
+        // Refinement criteria; the value for the last level given is used
+        // for the finer levels
+        pp.queryarr("rhoerr", m_rhoerr);
+        if (!m_rhoerr.empty()) {
+            Real last = m_rhoerr.back();
+            m_rhoerr.resize(max_level+1, last);
+        }
+
+        pp.queryarr("gradrhoerr", m_gradrhoerr);
+        if (!m_gradrhoerr.empty()) {
+            Real last = m_gradrhoerr.back();
+            m_gradrhoerr.resize(max_level+1, last);
+        }
+
+        tag_region_lo.resize(3);
+        tag_region_hi.resize(3);
+
+        pp.query("tag_region", m_tag_region);
+        pp.queryarr("tag_region_lo", tag_region_lo);
+        pp.queryarr("tag_region_hi", tag_region_hi);
     } // end prefix incflo
 
     ReadIOParameters();
@@ -167,13 +196,48 @@ void incflo::ReadParameters ()
         pp_mac.query( "mg_rtol"                , m_mac_mg_rtol );
         pp_mac.query( "mg_atol"                , m_mac_mg_atol );
         pp_mac.query( "mg_max_coarsening_level", m_mac_mg_max_coarsening_level );
+        pp_mac.query( "agglomeration"          , m_mac_mg_coarsening.agglomeration );
+        pp_mac.query( "agglomeration_grid_size", m_mac_mg_coarsening.agglomeration_grid_size );
+        pp_mac.query( "consolidation"          , m_mac_mg_coarsening.consolidation );
+        pp_mac.query( "consolidation_grid_size", m_mac_mg_coarsening.consolidation_grid_size );
+        pp_mac.query( "consolidation_ratio"    , m_mac_mg_coarsening.consolidation_ratio );
+        pp_mac.query( "consolidation_strategy" , m_mac_mg_coarsening.consolidation_strategy );
+        pp_mac.query( "bottom_ranks"           , m_mac_mg_coarsening.bottom_ranks );
+        pp_mac.query( "warm_start"             , m_mac_warm_start );
+        pp_mac.query( "solver"                 , m_mac_solver );
+        m_mac_solver = amrex::toLower(m_mac_solver);
+        if (m_mac_solver != "mlmg" && m_mac_solver != "fft") {
+            amrex::Abort("mac_proj.solver must be mlmg or fft");
+        }
+        pp_mac.query( "mixed_precision"        , m_mac_mixed_precision );
+        pp_mac.query( "mixed_precision_rtol"   , m_mac_mixed_precision_rtol );
+        pp_mac.query( "mixed_precision_maxiter", m_mac_mixed_precision_maxiter );
+        pp_mac.query( "adaptive_rtol"          , m_mac_adaptive_tol.enabled );
+        pp_mac.query( "adaptive_rtol_factor"   , m_mac_adaptive_tol.factor );
+        pp_mac.query( "adaptive_rtol_max"      , m_mac_adaptive_tol.max_rtol );
     } // end prefix mac
 
     { // Prefix nodal
         ParmParse pp_nodal("nodal_proj");
         pp_nodal.query( "mg_max_coarsening_level", m_nodal_mg_max_coarsening_level );
+        pp_nodal.query( "agglomeration"          , m_nodal_mg_coarsening.agglomeration );
+        pp_nodal.query( "agglomeration_grid_size", m_nodal_mg_coarsening.agglomeration_grid_size );
+        pp_nodal.query( "consolidation"          , m_nodal_mg_coarsening.consolidation );
+        pp_nodal.query( "consolidation_grid_size", m_nodal_mg_coarsening.consolidation_grid_size );
+        pp_nodal.query( "consolidation_ratio"    , m_nodal_mg_coarsening.consolidation_ratio );
+        pp_nodal.query( "consolidation_strategy" , m_nodal_mg_coarsening.consolidation_strategy );
+        pp_nodal.query( "bottom_ranks"           , m_nodal_mg_coarsening.bottom_ranks );
         pp_nodal.query( "mg_rtol"                , m_nodal_mg_rtol );
         pp_nodal.query( "mg_atol"                , m_nodal_mg_atol );
+        pp_nodal.query( "warm_start"             , m_nodal_warm_start );
+        pp_nodal.query( "adaptive_rtol"          , m_nodal_adaptive_tol.enabled );
+        pp_nodal.query( "adaptive_rtol_factor"   , m_nodal_adaptive_tol.factor );
+        pp_nodal.query( "adaptive_rtol_max"      , m_nodal_adaptive_tol.max_rtol );
+        pp_nodal.query( "solver"                 , m_nodal_solver );
+        m_nodal_solver = amrex::toLower(m_nodal_solver);
+        if (m_nodal_solver != "mlmg" && m_nodal_solver != "fft") {
+            amrex::Abort("nodal_proj.solver must be mlmg or fft");
+        }
     } // end prefix nodal
 
 #ifdef AMREX_USE_EB
@@ -394,6 +458,26 @@ void incflo::ReadIOParameters()
         m_smallplotVars.clear();
         pp.queryarr("smallplotVariables", m_smallplotVars);
     }
+
+    // Per-step performance telemetry (JSON lines); keep appending on restart
+    std::string telemetry_file;
+    pp.query("telemetry_file", telemetry_file);
+    m_telemetry.define(telemetry_file, !m_restart_file.empty());
+
+    // Write checkpoints and plotfiles in the background
+    bool async_output = false;
+    int async_output_max_pending = 2;
+    pp.query("async_output", async_output);
+    pp.query("async_max_pending", async_output_max_pending);
+    m_async_output.define(async_output, async_output_max_pending);
+
+    // Walltime budget (in seconds) and checkpoints on SIGUSR1 / SIGTERM
+    pp.query("max_walltime", m_max_walltime);
+    pp.query("walltime_margin", m_walltime_margin);
+    pp.query("checkpoint_on_signal", m_checkpoint_on_signal);
+    if (m_checkpoint_on_signal) {
+        InstallCheckpointSignalHandlers();
+    }
 }
 
 //
@@ -403,6 +487,8 @@ void incflo::InitialIterations ()
 {
     BL_PROFILE("incflo::InitialIterations()");
 
+    // The old-time slots have not been written yet; the predictor reads them
+    // and leaves them untouched, so each iteration starts from the same data
     copy_from_new_to_old_velocity();
     copy_from_new_to_old_density();
     copy_from_new_to_old_tracer();
@@ -423,19 +509,23 @@ void incflo::InitialIterations ()
 
     int ng = nghost_state();
     for (int lev = 0; lev <= finest_level; ++lev) {
-            fillpatch_velocity(lev, m_t_old[lev], m_leveldata[lev]->velocity_o, ng);
+        fillpatch_velocity(lev, m_t_old[lev], m_leveldata[lev]->velocity_o, ng);
         fillpatch_density(lev, m_t_old[lev], m_leveldata[lev]->density_o, ng);
         if (m_advect_tracer) {
             fillpatch_tracer(lev, m_t_old[lev], m_leveldata[lev]->tracer_o, ng);
         }
+        m_leveldata[lev]->ng_valid_old = ng;
     }
 
     for (int iter = 0; iter < m_initial_iterations; ++iter)
     {
         if (m_verbose) amrex::Print() << "\n In initial_iterations: iter = " << iter << "\n";
 
-     ApplyPredictor(true);
+        ApplyPredictor(true);
+    }
 
+    // Put the initial state back in the new-time slots, leaving both equal
+    if (m_initial_iterations > 0) {
         copy_from_old_to_new_velocity();
         copy_from_old_to_new_density();
         copy_from_old_to_new_tracer();
@@ -452,22 +542,18 @@ void incflo::InitialProjection()
     BL_PROFILE("incflo::InitialProjection()");
 
     // *************************************************************************************
-    // Allocate space for the temporary MAC velocities
+    // Get space for the temporary MAC velocities (shared with ApplyPredictor/ApplyCorrector)
     // *************************************************************************************
-    Vector<MultiFab> u_mac_tmp(finest_level+1), v_mac_tmp(finest_level+1), w_mac_tmp(finest_level+1);
     int ngmac = nghost_mac();
+    AMREX_D_TERM(auto u_mac_tmp = get_scratch("u_mac", IndexType(IntVect::TheDimensionVector(0)), 1, ngmac);,
+                 auto v_mac_tmp = get_scratch("v_mac", IndexType(IntVect::TheDimensionVector(1)), 1, ngmac);,
+                 auto w_mac_tmp = get_scratch("w_mac", IndexType(IntVect::TheDimensionVector(2)), 1, ngmac););
 
     for (int lev = 0; lev <= finest_level; ++lev) {
-        AMREX_D_TERM(u_mac_tmp[lev].define(amrex::convert(grids[lev],IntVect::TheDimensionVector(0)), dmap[lev],
-                          1, ngmac, MFInfo(), Factory(lev));,
-                     v_mac_tmp[lev].define(amrex::convert(grids[lev],IntVect::TheDimensionVector(1)), dmap[lev],
-                          1, ngmac, MFInfo(), Factory(lev));,
-                     w_mac_tmp[lev].define(amrex::convert(grids[lev],IntVect::TheDimensionVector(2)), dmap[lev],
-                          1, ngmac, MFInfo(), Factory(lev)););
         if (ngmac > 0) {
-            AMREX_D_TERM(u_mac_tmp[lev].setBndry(0.0);,
-                         v_mac_tmp[lev].setBndry(0.0);,
-                         w_mac_tmp[lev].setBndry(0.0););
+            AMREX_D_TERM(u_mac_tmp[lev]->setBndry(0.0);,
+                         v_mac_tmp[lev]->setBndry(0.0);,
+                         w_mac_tmp[lev]->setBndry(0.0););
         }
     }
 
@@ -479,9 +565,10 @@ void incflo::InitialProjection()
     }
 
     ApplyProjection(get_density_new_const(),
-                    AMREX_D_DECL(GetVecOfPtrs(u_mac_tmp), GetVecOfPtrs(v_mac_tmp),
-                    GetVecOfPtrs(w_mac_tmp)),m_cur_time,dummy_dt,incremental_projection);
+                    AMREX_D_DECL(u_mac_tmp, v_mac_tmp, w_mac_tmp),m_cur_time,dummy_dt,incremental_projection);
 
+    // The projection changed the new velocity in place
+    new_velocity_changed();
 
     // We set p and gp back to zero (p0 may still be still non-zero)
     for (int lev = 0; lev <= finest_level; lev++)
@@ -512,26 +599,6 @@ void incflo::InitialPressureProjection()
         m_leveldata[lev]->density.FillBoundary(geom[lev].periodicity());
     }
 
-    // *************************************************************************************
-    // Allocate space for the temporary MAC velocities
-    // *************************************************************************************
-    Vector<MultiFab> u_mac_tmp(finest_level+1), v_mac_tmp(finest_level+1), w_mac_tmp(finest_level+1);
-    int ngmac = nghost_mac();
-
-    for (int lev = 0; lev <= finest_level; ++lev) {
-        AMREX_D_TERM(u_mac_tmp[lev].define(amrex::convert(grids[lev],IntVect::TheDimensionVector(0)), dmap[lev],
-                          1, ngmac, MFInfo(), Factory(lev));,
-                     v_mac_tmp[lev].define(amrex::convert(grids[lev],IntVect::TheDimensionVector(1)), dmap[lev],
-                          1, ngmac, MFInfo(), Factory(lev));,
-                     w_mac_tmp[lev].define(amrex::convert(grids[lev],IntVect::TheDimensionVector(2)), dmap[lev],
-                          1, ngmac, MFInfo(), Factory(lev)););
-        if (ngmac > 0) {
-            AMREX_D_TERM(u_mac_tmp[lev].setBndry(0.0);,
-                         v_mac_tmp[lev].setBndry(0.0);,
-                         w_mac_tmp[lev].setBndry(0.0););
-        }
-    }
-
     // Set the velocity to the gravity field
     Vector<MultiFab> vel(finest_level + 1);
     for (int lev = 0; lev <= finest_level; ++lev) {
@@ -664,6 +731,9 @@ incflo::InitialRedistribution ()
         ld.density.FillBoundary(geom[lev].periodicity());
         ld.tracer.FillBoundary(geom[lev].periodicity());
     }
+
+    // Both the new and the old velocity were written in place
+    reset_strainrate_cache();
   }
 }
 #endif
@@ -0,0 +1,102 @@
+#include <incflo_async_output.H>
+
+#include <AMReX_AsyncOut.H>
+#include <AMReX_Print.H>
+#include <AMReX_VisMF.H>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+using namespace amrex;
+
+struct AsyncOutput::State
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    int pending = 0;
+    double last_timed = -1.0;
+};
+
+AsyncOutput::AsyncOutput ()
+    : m_state(std::make_shared<State>())
+{}
+
+void
+AsyncOutput::define (bool enabled, int max_pending)
+{
+    AMREX_ALWAYS_ASSERT(max_pending > 0);
+    m_max_pending = max_pending;
+
+    if (enabled && !AsyncOut::UseAsyncOut()) {
+        amrex::Warning("amr.async_output requires amrex.async_out = 1; writing output synchronously");
+        enabled = false;
+    }
+    m_enabled = enabled;
+}
+
+void
+AsyncOutput::wait_for_slot ()
+{
+    if (!m_enabled) { return; }
+
+    BL_PROFILE("AsyncOutput::wait_for_slot()");
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+    m_state->cv.wait(lock, [&] { return m_state->pending < m_max_pending; });
+}
+
+void
+AsyncOutput::submitted (double staged_seconds)
+{
+    if (!m_enabled) { return; }
+
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        ++m_state->pending;
+    }
+
+    // The I/O thread runs its jobs in order, so this runs once all the
+    // writes of this output have completed
+    std::shared_ptr<State> state = m_state;
+    auto const submit_time = std::chrono::steady_clock::now();
+    AsyncOut::Submit([state, staged_seconds, submit_time] ()
+    {
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            --state->pending;
+            if (staged_seconds >= 0.0) {
+                std::chrono::duration<double> const written =
+                    std::chrono::steady_clock::now() - submit_time;
+                state->last_timed = staged_seconds + written.count();
+            }
+        }
+        state->cv.notify_all();
+    });
+}
+
+double
+AsyncOutput::last_timed_seconds () const
+{
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->last_timed;
+}
+
+void
+AsyncOutput::flush ()
+{
+    if (!m_enabled) { return; }
+
+    BL_PROFILE("AsyncOutput::flush()");
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+    m_state->cv.wait(lock, [&] { return m_state->pending == 0; });
+}
+
+void
+AsyncOutput::write (MultiFab const& mf, std::string const& mf_name) const
+{
+    if (m_enabled) {
+        VisMF::AsyncWrite(mf, mf_name);
+    } else {
+        VisMF::Write(mf, mf_name);
+    }
+}
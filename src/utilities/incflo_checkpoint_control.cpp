@@ -0,0 +1,94 @@
+#include <incflo.H>
+
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+
+using namespace amrex;
+
+namespace {
+    // 0: nothing, 1: checkpoint (SIGUSR1), 2: checkpoint and stop (SIGTERM)
+    std::atomic<int> checkpoint_signal{0};
+
+    void incflo_checkpoint_signal_handler (int sig)
+    {
+        int request = (sig == SIGTERM) ? 2 : 1;
+        if (request > checkpoint_signal.load()) {
+            checkpoint_signal.store(request);
+        }
+    }
+
+    // Number of recent steps used to predict the cost of the next one
+    constexpr int num_recent_steps = 5;
+}
+
+void incflo::InstallCheckpointSignalHandlers ()
+{
+    std::signal(SIGUSR1, incflo_checkpoint_signal_handler);
+    std::signal(SIGTERM, incflo_checkpoint_signal_handler);
+}
+
+//
+// Called at the end of every step. Returns true if a checkpoint must be
+// written now, and sets stop if the run should end after it, either because
+// of a SIGTERM or because another step plus a checkpoint would not fit in
+// m_max_walltime.
+//
+// Signals are usually delivered to only some of the ranks, so the decision is
+// taken on the max over all ranks of this run (which in an ensemble is only a
+// sub-communicator), at the cost of one reduction per step.
+//
+bool incflo::CheckpointRequested (bool& stop)
+{
+    stop = false;
+
+    if (m_max_walltime <= Real(0.0) && !m_checkpoint_on_signal) { return false; }
+
+    BL_PROFILE("incflo::CheckpointRequested()");
+
+    double now = ParallelDescriptor::second();
+    m_wall_recent_steps.push_back(now - m_wall_last_step);
+    if (static_cast<int>(m_wall_recent_steps.size()) > num_recent_steps) {
+        m_wall_recent_steps.erase(m_wall_recent_steps.begin());
+    }
+    m_wall_last_step = now;
+
+    // Be pessimistic: the next step is as slow as the slowest recent one
+    // (which may have included a regrid or plotfile) and needs a checkpoint
+    // after it. A checkpoint costs the time until it is on disk, which with
+    // asynchronous output is only known once one has completed; until then,
+    // assume it costs a step.
+    double next_step = *std::max_element(m_wall_recent_steps.begin(), m_wall_recent_steps.end());
+    double checkpoint = (m_async_output.enabled()) ? m_async_output.last_timed_seconds()
+                                                   : m_wall_checkpoint;
+    if (checkpoint <= 0.0) { checkpoint = next_step; }
+
+    Real buf[3] = { static_cast<Real>(checkpoint_signal.exchange(0)),
+                    static_cast<Real>(now - m_wall_start),
+                    static_cast<Real>(next_step + checkpoint) };
+    ParallelAllReduce::Max<Real>(buf, 3, ParallelContext::CommunicatorSub());
+
+    const int signal_request = static_cast<int>(buf[0]);
+    const Real elapsed = buf[1];
+    const Real predicted = buf[2];
+
+    if (signal_request > 0)
+    {
+        stop = (signal_request == 2);
+        amrex::Print() << "\nCheckpoint requested by signal after step " << m_nstep
+                       << (stop ? "; stopping" : "") << std::endl;
+        return true;
+    }
+
+    if (m_max_walltime > Real(0.0) &&
+        elapsed + predicted + m_walltime_margin > m_max_walltime)
+    {
+        stop = true;
+        amrex::Print() << "\nElapsed walltime " << elapsed << " s plus " << predicted
+                       << " s for another step and checkpoint would exceed max_walltime = "
+                       << m_max_walltime << " s; checkpointing and stopping" << std::endl;
+        return true;
+    }
+
+    return false;
+}
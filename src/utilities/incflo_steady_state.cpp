@@ -1,9 +1,38 @@
 #include <incflo.H>
 
+#include <algorithm>
+
 using namespace amrex;
 
+#ifdef AMREX_USE_MPI
+namespace {
+
+// MPI reduction of a buffer [nsum, nsum values to sum, values to max], so
+// that the sums and maxima of the steady state check need one allreduce. The
+// buffer is sent as a single element of a contiguous type, so that it is
+// never split up.
+void sum_then_max (void* invec, void* inoutvec, int* /*len*/, MPI_Datatype* datatype)
+{
+    int nbytes = 0;
+    MPI_Type_size(*datatype, &nbytes);
+    int const n = nbytes / static_cast<int>(sizeof(Real));
+
+    auto const* in = static_cast<Real const*>(invec);
+    auto* inout = static_cast<Real*>(inoutvec);
+    int const nsum = static_cast<int>(in[0]);
+    for (int i = 1; i <= nsum; ++i) {
+        inout[i] += in[i];
+    }
+    for (int i = nsum+1; i < n; ++i) {
+        inout[i] = std::max(inout[i], in[i]);
+    }
+}
+
+}
+#endif
+
 //
-// Check if steady state has been reached by verifying that
+// Check if steady state has been reached by verifying that, on every level,
 //
 //      max(abs( u^(n+1) - u^(n) )) / dt < tol
 //      max(abs( v^(n+1) - v^(n) )) / dt < tol
@@ -15,73 +44,125 @@ using namespace amrex;
 //      sum(abs( v^(n+1) - v^(n) )) / sum(abs( v^(n) )) < tol
 //      sum(abs( w^(n+1) - w^(n) )) / sum(abs( w^(n) )) < tol
 //
-bool incflo::SteadyStateReached()
+// All norms of a level are computed in a single pass over the velocity and
+// the first condition is evaluated by counting the cells that violate it, so
+// that everything can be combined in one sum over all levels and ranks. The
+// max-norms, which are only printed, go through the same allreduce.
+//
+bool incflo::SteadyStateReached () const
 {
-
-    amrex::Abort("xxxxx TODO: SteadyStateReached");
-    return false;
-#if 0
     BL_PROFILE("incflo::SteadyStateReached()");
 
-    int condition1[finest_level + 1];
-    int condition2[finest_level + 1];
+    // Always return negative to first access. This way
+    // initial zero velocity field do not test for false positive
+    if (m_nstep < 2) { return false; }
+
+    // Only check every m_steady_state_int steps
+    if (m_steady_state_int > 1 && m_nstep % m_steady_state_int != 0) { return false; }
+
+    const int nlevs = finest_level + 1;
+
+    // For each level: [ # cells with |u^(n+1)-u^n| >= tol*dt,
+    //                   sum |u^(n+1)-u^n| (one per component),
+    //                   sum |u^n|         (one per component) ]
+    //
+    // buf holds [number of sums, the sums of all levels, max |u^(n+1)-u^n|
+    // of all levels]
+    constexpr int nvals = 1 + 2*AMREX_SPACEDIM;
+    const int nsum = nvals*nlevs;
+    Vector<Real> buf(1 + nsum + nlevs, Real(0.0));
+    buf[0] = Real(nsum);
+    Real* sums = buf.data() + 1;
+    Real* max_change = sums + nsum;
 
-    // Make sure velocity is up to date
-    incflo_set_velocity_bcs(m_cur_time, vel);
+    const Real change_tol = m_steady_state_tol * m_dt;
 
-    // Use temporaries to store the difference between current and previous solution
-    Vector<std::unique_ptr<MultiFab>> diff_vel;
-    diff_vel.resize(finest_level + 1);
-    for(int lev = 0; lev <= finest_level; lev++)
+    for (int lev = 0; lev <= finest_level; ++lev)
     {
-#ifdef AMREX_USE_EB
-        diff_vel[lev].reset(new MultiFab(grids[lev], dmap[lev], AMREX_SPACEDIM, 0, MFInfo(), *ebfactory[lev]));
+        auto const& vel   = m_leveldata[lev]->velocity.const_arrays();
+        auto const& vel_o = m_leveldata[lev]->velocity_o.const_arrays();
+
+#if (AMREX_SPACEDIM == 2)
+        ReduceOps<ReduceOpMax, ReduceOpSum,
+                  ReduceOpSum, ReduceOpSum,
+                  ReduceOpSum, ReduceOpSum> reduce_op;
+        ReduceData<Real, Real,
+                   Real, Real,
+                   Real, Real> reduce_data(reduce_op);
 #else
-        diff_vel[lev].reset(new MultiFab(grids[lev], dmap[lev], AMREX_SPACEDIM, 0, MFInfo()));
+        ReduceOps<ReduceOpMax, ReduceOpSum,
+                  ReduceOpSum, ReduceOpSum, ReduceOpSum,
+                  ReduceOpSum, ReduceOpSum, ReduceOpSum> reduce_op;
+        ReduceData<Real, Real,
+                   Real, Real, Real,
+                   Real, Real, Real> reduce_data(reduce_op);
 #endif
-        MultiFab::LinComb(*diff_vel[lev], 1.0, *vel[lev], 0, -1.0, *vel_o[lev], 0, 0, AMREX_SPACEDIM, 0);
+        using ReduceTuple = typename decltype(reduce_data)::Type;
+
+        reduce_op.eval(m_leveldata[lev]->velocity, IntVect(0), reduce_data,
+        [=] AMREX_GPU_DEVICE (int box_no, int i, int j, int k) noexcept -> ReduceTuple
+        {
+            AMREX_D_TERM(Real du = amrex::Math::abs(vel[box_no](i,j,k,0) - vel_o[box_no](i,j,k,0));,
+                         Real dv = amrex::Math::abs(vel[box_no](i,j,k,1) - vel_o[box_no](i,j,k,1));,
+                         Real dw = amrex::Math::abs(vel[box_no](i,j,k,2) - vel_o[box_no](i,j,k,2)););
+            Real dmax = amrex::max(AMREX_D_DECL(du,dv,dw));
+            return { dmax, (dmax >= change_tol) ? Real(1.0) : Real(0.0),
+                     AMREX_D_DECL(du,dv,dw),
+                     AMREX_D_DECL(amrex::Math::abs(vel_o[box_no](i,j,k,0)),
+                                  amrex::Math::abs(vel_o[box_no](i,j,k,1)),
+                                  amrex::Math::abs(vel_o[box_no](i,j,k,2))) };
+        });
+
+        auto hv = reduce_data.value(reduce_op);
+        max_change[lev] = amrex::get<0>(hv);
+        sums[nvals*lev] = amrex::get<1>(hv);
+        AMREX_D_TERM(sums[nvals*lev+1] = amrex::get<2>(hv);,
+                     sums[nvals*lev+2] = amrex::get<3>(hv);,
+                     sums[nvals*lev+3] = amrex::get<4>(hv););
+        AMREX_D_TERM(sums[nvals*lev+1+AMREX_SPACEDIM] = amrex::get<2+AMREX_SPACEDIM>(hv);,
+                     sums[nvals*lev+2+AMREX_SPACEDIM] = amrex::get<3+AMREX_SPACEDIM>(hv);,
+                     sums[nvals*lev+3+AMREX_SPACEDIM] = amrex::get<4+AMREX_SPACEDIM>(hv););
+    }
+
+#ifdef AMREX_USE_MPI
+    MPI_Datatype buf_type;
+    MPI_Type_contiguous(static_cast<int>(buf.size()), ParallelDescriptor::Mpi_typemap<Real>::type(),
+                        &buf_type);
+    MPI_Type_commit(&buf_type);
+    MPI_Op op;
+    MPI_Op_create(sum_then_max, 1, &op);
+    MPI_Allreduce(MPI_IN_PLACE, buf.data(), 1, buf_type, op, ParallelContext::CommunicatorSub());
+    MPI_Op_free(&op);
+    MPI_Type_free(&buf_type);
+#endif
+
+    bool reached = true;
+    for (int lev = 0; lev <= finest_level; ++lev)
+    {
+        Real const* lev_sums = sums + nvals*lev;
 
-        Real max_change = 0.0;
-        Real max_relchange = 0.0;
-        // Loop over components, only need to check the largest one
-        for(int i = 0; i < AMREX_SPACEDIM; i++)
+        Real max_relchange = Real(0.0);
+        for (int idim = 0; idim < AMREX_SPACEDIM; ++idim)
         {
-            // max(abs(u^{n+1}-u^n))
-            max_change = amrex::max(max_change, Norm(diff_vel, lev, i, 0));
-
-            // sum(abs(u^{n+1}-u^n)) / sum(abs(u^n))
-            // TODO: this gives zero often, check for bug
-            Real norm1_diff = Norm(diff_vel, lev, i, 1);
-            Real norm1_old = Norm(vel_o, lev, i, 1);
-            Real relchange = norm1_old > 1.0e-15 ? norm1_diff / norm1_old : 0.0;
+            Real norm1_diff = lev_sums[1+idim];
+            Real norm1_old  = lev_sums[1+AMREX_SPACEDIM+idim];
+            Real relchange = (norm1_old > Real(1.0e-15)) ? norm1_diff / norm1_old : Real(0.0);
             max_relchange = amrex::max(max_relchange, relchange);
         }
 
-        condition1[lev] = (max_change < m_steady_state_tol * dt);
-        condition2[lev] = (max_relchange < m_steady_state_tol);
+        bool condition1 = (lev_sums[0] == Real(0.0));
+        bool condition2 = (max_relchange < m_steady_state_tol);
 
         // Print out info on steady state checks
         if (m_verbose > 0)
         {
             amrex::Print() << "\nSteady state check level " << lev << std::endl;
             amrex::Print() << "||u-uo||/||uo|| = " << max_relchange
-                           << ", du/dt  = " << max_change/dt << std::endl;
+                           << ", du/dt  = " << max_change[lev]/m_dt << std::endl;
         }
-    }
 
-    bool reached = true;
-    for(int lev = 0; lev <= finest_level; lev++)
-    {
-        reached = reached && (condition1[lev] || condition2[lev]);
+        reached = reached && (condition1 || condition2);
     }
 
-    // Always return negative to first access. This way
-    // initial zero velocity field do not test for false positive
-    if(m_nstep < 2)
-    {
-        return false;
-    } else {
-        return reached;
-    }
-#endif
+    return reached;
 }
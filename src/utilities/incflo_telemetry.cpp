@@ -0,0 +1,157 @@
+#include <incflo_telemetry.H>
+
+#include <AMReX_BaseFab.H>
+#include <AMReX_ParallelContext.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_ParallelReduce.H>
+#include <AMReX_Utility.H>
+
+#include <iomanip>
+#include <limits>
+
+using namespace amrex;
+
+namespace {
+    const char* phase_names[] = {
+        "predictor", "corrector", "mac_proj", "nodal_proj", "diffusion", "fillpatch", "io"
+    };
+}
+
+Telemetry::Timer::Timer (Telemetry& telemetry, Phase phase)
+    : m_telemetry(telemetry.enabled() ? &telemetry : nullptr),
+      m_phase(phase)
+{
+    if (m_telemetry) { m_start = ParallelDescriptor::second(); }
+}
+
+Telemetry::Timer::~Timer ()
+{
+    if (m_telemetry) {
+        m_telemetry->add_time(m_phase, ParallelDescriptor::second() - m_start);
+    }
+}
+
+void
+Telemetry::define (std::string const& filename, bool append)
+{
+    m_enabled = !filename.empty();
+    m_filename = filename;
+    m_append = append;
+}
+
+void
+Telemetry::begin_step ()
+{
+    m_phase_time.fill(0.0);
+    m_step_time = 0.0;
+    m_solves.clear();
+}
+
+void
+Telemetry::add_time (Phase phase, double seconds)
+{
+    m_phase_time[static_cast<int>(phase)] += seconds;
+}
+
+void
+Telemetry::record_solve (std::string const& name, int iters, Real residual, Real rtol)
+{
+    if (m_enabled) {
+        m_solves.push_back(Solve{name, iters, residual, rtol});
+    }
+}
+
+void
+Telemetry::set_solve_guess (int npoints, Real init_residual)
+{
+    if (m_enabled && !m_solves.empty()) {
+        m_solves.back().guess = npoints;
+        m_solves.back().init_residual = init_residual;
+    }
+}
+
+void
+Telemetry::set_dt (Real dt, Real conv_cfl, Real diff_cfl, Real forc_cfl)
+{
+    m_dt = dt;
+    m_cfl = {conv_cfl, diff_cfl, forc_cfl};
+
+    // dt is 2 cfl / (cd + sqrt(cd^2 + 4 F)) with cd = conv + diff, so the
+    // forcing dominates once 4 F exceeds cd^2
+    Real cd = conv_cfl + diff_cfl;
+    if (cd <= Real(0.0) && forc_cfl <= Real(0.0)) {
+        m_dt_limit = "none";
+    } else if (Real(4.0)*forc_cfl > cd*cd) {
+        m_dt_limit = "force";
+    } else {
+        m_dt_limit = (diff_cfl > conv_cfl) ? "diff" : "conv";
+    }
+}
+
+double
+Telemetry::end_step (int nstep, Real time)
+{
+    // Everything that has to be combined across ranks goes in one buffer:
+    // [ phase times..., step time, Fab memory high-water mark ]
+    std::array<double,num_phases+2> buf{};
+    for (int i = 0; i < num_phases; ++i) { buf[i] = m_phase_time[i]; }
+    buf[num_phases  ] = m_step_time;
+    buf[num_phases+1] = static_cast<double>(TotalBytesAllocatedInFabsHWM());
+
+    ParallelReduce::Max<double>(buf.data(), static_cast<int>(buf.size()),
+                                ParallelContext::IOProcessorNumberSub(),
+                                ParallelContext::CommunicatorSub());
+
+    if (m_enabled && ParallelContext::IOProcessorSub())
+    {
+        if (!m_ofs.is_open()) {
+            m_ofs.open(m_filename, m_append ? std::ios::app : std::ios::trunc);
+            if (!m_ofs.good()) {
+                amrex::FileOpenFailed(m_filename);
+            }
+        }
+
+        m_ofs << std::setprecision(std::numeric_limits<Real>::max_digits10)
+              << "{\"step\":" << nstep
+              << ",\"time\":" << time
+              << ",\"dt\":" << m_dt
+              << ",\"dt_limit\":\"" << m_dt_limit << "\""
+              << ",\"cfl\":{\"conv\":" << m_cfl[0]
+              << ",\"diff\":" << m_cfl[1]
+              << ",\"force\":" << m_cfl[2] << "}";
+
+        m_ofs << std::setprecision(6) << ",\"wall\":{\"step\":" << buf[num_phases];
+        for (int i = 0; i < num_phases; ++i) {
+            m_ofs << ",\"" << phase_names[i] << "\":" << buf[i];
+        }
+        m_ofs << "}";
+
+        m_ofs << std::setprecision(std::numeric_limits<Real>::max_digits10) << ",\"solves\":[";
+        for (int i = 0; i < static_cast<int>(m_solves.size()); ++i) {
+            m_ofs << (i > 0 ? "," : "")
+                  << "{\"name\":\"" << m_solves[i].name << "\""
+                  << ",\"iters\":" << m_solves[i].iters
+                  << ",\"residual\":" << m_solves[i].residual;
+            if (m_solves[i].rtol >= Real(0.0)) {
+                m_ofs << ",\"rtol\":" << m_solves[i].rtol;
+            }
+            if (m_solves[i].guess >= 0) {
+                m_ofs << ",\"guess\":" << m_solves[i].guess
+                      << ",\"init_residual\":" << m_solves[i].init_residual;
+            }
+            m_ofs << "}";
+        }
+        m_ofs << "]";
+
+        m_ofs << ",\"cells\":[";
+        for (int lev = 0; lev < static_cast<int>(m_cells.size()); ++lev) {
+            m_ofs << (lev > 0 ? "," : "") << m_cells[lev];
+        }
+        m_ofs << "]";
+
+        m_ofs << ",\"fab_bytes_hwm\":" << static_cast<Long>(buf[num_phases+1])
+              << "}\n" << std::flush;
+    }
+
+    return buf[num_phases];
+}
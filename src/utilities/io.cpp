@@ -66,14 +66,19 @@ void incflo::WriteHeader(const std::string& name, bool is_checkpoint) const
     }
 }
 
-void incflo::WriteCheckPointFile() const
+void incflo::WriteCheckPointFile()
 {
     BL_PROFILE("incflo::WriteCheckPointFile()");
 
+    double strt_chk = ParallelDescriptor::second();
+
     const std::string& checkpointname = amrex::Concatenate(m_check_file, m_nstep);
 
     amrex::Print() << "\n\t Writing checkpoint " << checkpointname << std::endl;
 
+    // Don't stage more data while too many outputs are still being written
+    m_async_output.wait_for_slot();
+
     amrex::PreBuildDirectorHierarchy(checkpointname, level_prefix, finest_level + 1, true);
 
     bool is_checkpoint = true;
@@ -82,32 +87,38 @@ void incflo::WriteCheckPointFile() const
 
     for(int lev = 0; lev <= finest_level; ++lev)
     {
-        VisMF::Write(m_leveldata[lev]->velocity,
-                     amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "velocity"));
+        m_async_output.write(m_leveldata[lev]->velocity,
+                             amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "velocity"));
 
-        VisMF::Write(m_leveldata[lev]->density,
-                     amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "density"));
+        m_async_output.write(m_leveldata[lev]->density,
+                             amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "density"));
 
         if (m_ntrac > 0) {
-            VisMF::Write(m_leveldata[lev]->tracer,
-                         amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "tracer"));
+            m_async_output.write(m_leveldata[lev]->tracer,
+                                 amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "tracer"));
         }
 
-        VisMF::Write(m_leveldata[lev]->gp,
-                     amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "gradp"));
+        m_async_output.write(m_leveldata[lev]->gp,
+                             amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "gradp"));
 
         if (m_use_cc_proj) {
-            VisMF::Write(m_leveldata[lev]->p_cc,
-                         amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "p_cc"));
+            m_async_output.write(m_leveldata[lev]->p_cc,
+                                 amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "p_cc"));
         } else {
-            VisMF::Write(m_leveldata[lev]->p_nd,
-                         amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "p_nd"));
+            m_async_output.write(m_leveldata[lev]->p_nd,
+                                 amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "p_nd"));
         }
     }
 
 #ifdef INCFLO_USE_PARTICLES
    particleData.Checkpoint(checkpointname);
 #endif
+
+    // With asynchronous output this only covers the staging; m_async_output
+    // also times the output until it is on disk
+    m_wall_checkpoint = ParallelDescriptor::second() - strt_chk;
+
+    m_async_output.submitted(m_wall_checkpoint);
 }
 
 void incflo::ReadCheckpointFile()
@@ -231,15 +242,26 @@ void incflo::ReadCheckpointFile()
         VisMF::Read(m_leveldata[lev]->gp,
                     amrex::MultiFabFileFullPrefix(lev, m_restart_file, level_prefix, "gradp"));
 
-        if (m_use_cc_proj) {
-            VisMF::Read(m_leveldata[lev]->p_cc,
-                        amrex::MultiFabFileFullPrefix(lev, m_restart_file, level_prefix, "p_cc"));
+        // A checkpoint only holds the pressure of the projection it was written
+        //     with. Restarting with the other projection (e.g. to compare them)
+        //     starts from p = 0; gradp, which drives the flow, is still read.
+        std::string const p_name = m_use_cc_proj ? "p_cc" : "p_nd";
+        std::string const p_file = amrex::MultiFabFileFullPrefix(lev, m_restart_file, level_prefix, p_name);
+        MultiFab& p = m_use_cc_proj ? m_leveldata[lev]->p_cc : m_leveldata[lev]->p_nd;
+        if (amrex::FileExists(p_file + "_H")) {
+            VisMF::Read(p, p_file);
         } else {
-            VisMF::Read(m_leveldata[lev]->p_nd,
-                        amrex::MultiFabFileFullPrefix(lev, m_restart_file, level_prefix, "p_nd"));
+            if (lev == 0) {
+                amrex::Warning("Checkpoint " + m_restart_file + " has no " + p_name +
+                               "; starting from zero pressure");
+            }
+            p.setVal(0.0);
         }
     }
 
+    // The velocity was read in place
+    new_velocity_changed();
+
 #ifdef INCFLO_USE_PARTICLES
    particleData.Restart((ParGDBBase*)GetParGDB(),m_restart_file);
 #endif
@@ -342,6 +364,8 @@ void incflo::WritePlotFile()
 
     amrex::Print() << "  Writing plotfile " << plotfilename << " at time " << m_cur_time << std::endl;
 
+    m_async_output.wait_for_slot();
+
     // Write the plotfile
     WritePlotVariables(m_plotVars, plotfilename);
 
@@ -350,6 +374,8 @@ void incflo::WritePlotFile()
 #ifdef INCFLO_USE_PARTICLES
     particleData.Checkpoint(plotfilename);
 #endif
+
+    m_async_output.submitted();
 }
 
 void incflo::WriteSmallPlotFile()
@@ -360,8 +386,12 @@ void incflo::WriteSmallPlotFile()
 
     amrex::Print() << "  Writing smallplotfile " << plotfilename << " at time " << m_cur_time << std::endl;
 
+    m_async_output.wait_for_slot();
+
     // Write the plotfile
     WritePlotVariables(m_smallplotVars, plotfilename);
+
+    m_async_output.submitted();
 }
 
 void incflo::WritePlotVariables(Vector<std::string> vars, const std::string& plotfilename)
@@ -372,20 +402,36 @@ void incflo::WritePlotVariables(Vector<std::string> vars, const std::string& plo
         Abort("incflo::WritePlotVariables : Must specify at least one variable to plot");
     }
 
+    bool need_ghosts = false;
+    bool need_strainrate = false;
     for(int n = 0; n < vars.size(); n++) {
         if (vars[n] == "vort" || vars[n] == "divu" || vars[n] == "forcing" ||
             vars[n] == "eta"  || vars[n] == "strainrate") {
-            for (int lev = 0; lev <= finest_level; ++lev) {
+            need_ghosts = true;
+        }
+        if (vars[n] == "strainrate" ||
+            (vars[n] == "eta" && m_fluid_model != FluidModel::Newtonian)) {
+            need_strainrate = true;
+        }
+    }
+
+    if (need_ghosts) {
+        for (int lev = 0; lev <= finest_level; ++lev) {
 #ifdef AMREX_USE_EB
-                const int ng = (EBFactory(0).isAllRegular()) ? 1 : 2;
+            int ng = (EBFactory(0).isAllRegular()) ? 1 : 2;
 #else
-                const int ng = 1;
+            int ng = 1;
 #endif
-                fillpatch_velocity(lev, m_cur_time, m_leveldata[lev]->velocity, ng);
-                fillpatch_density(lev, m_cur_time, m_leveldata[lev]->density, ng);
-                fillpatch_tracer(lev, m_cur_time, m_leveldata[lev]->tracer, ng);
+            // The strain rate is computed on one ghost cell, so that the
+            // predictor of the next step can reuse it
+            if (need_strainrate) { ++ng; }
+            fillpatch_velocity(lev, m_cur_time, m_leveldata[lev]->velocity, ng);
+            fillpatch_density(lev, m_cur_time, m_leveldata[lev]->density, ng);
+            fillpatch_tracer(lev, m_cur_time, m_leveldata[lev]->tracer, ng);
+
+            if (need_strainrate) {
+                strainrate_and_eta(lev, m_leveldata[lev]->velocity, 1);
             }
-            break;
         }
     }
 